@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <gsl/array_file> // for array_file, write_array_file
+
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+
+#include <gsl/span>        // for span, as_bytes
+#include <gsl/span_cursor> // for span_reader
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint32_t, uint64_t
+#include <cstdlib> // for mkstemp
+#include <string>  // for string
+#include <vector>  // for vector
+
+#include <fcntl.h>  // for open, O_RDONLY
+#include <unistd.h> // for read, close, unlink
+
+// Files of 16 byte records, in bytes, from the L2 cache out to main memory. The files stay in the
+// page cache, so the numbers are for loading, not for the disk.
+#define GSL_BENCHMARK_SIZES Arg(256 << 10)->Arg(4 << 20)->Arg(64 << 20)
+
+namespace
+{
+struct record
+{
+    std::uint64_t id;
+    std::uint32_t a;
+    std::uint32_t b;
+};
+
+// an array file of state.range(0) bytes of records, removed again by the destructor
+class records_file
+{
+public:
+    explicit records_file(const benchmark::State& state) : path_("/tmp/gsl_benchmark_XXXXXX")
+    {
+        ::close(::mkstemp(&path_[0]));
+        std::vector<record> v(static_cast<std::size_t>(state.range(0)) / sizeof(record));
+        for (std::size_t i = 0; i < v.size(); ++i)
+            v[i] = {i, static_cast<std::uint32_t>(i * 3), static_cast<std::uint32_t>(i * 7)};
+        gsl::write_array_file(path_.c_str(), gsl::make_span(v));
+    }
+
+    records_file(const records_file&) = delete;
+    records_file& operator=(const records_file&) = delete;
+
+    ~records_file() { ::unlink(path_.c_str()); }
+
+    const char* path() const { return path_.c_str(); }
+
+private:
+    std::string path_;
+};
+
+void set_processed(benchmark::State& state)
+{
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+// reading the file and decoding every record into a vector
+void load_parse(benchmark::State& state)
+{
+    const records_file file{state};
+    for (auto _ : state)
+    {
+        std::vector<unsigned char> bytes(static_cast<std::size_t>(state.range(0)) + 64);
+        const int fd = ::open(file.path(), O_RDONLY);
+        std::size_t size = 0;
+        for (ssize_t n = 0; (n = ::read(fd, bytes.data() + size, bytes.size() - size)) > 0;)
+            size += static_cast<std::size_t>(n);
+        ::close(fd);
+
+        gsl::span_reader r{gsl::as_bytes(gsl::span<const unsigned char>{bytes.data(), size})};
+        r.skip(64);
+        std::vector<record> records(r.remaining() / sizeof(record));
+        for (record& e : records)
+        {
+            gsl::span_reader h = r.ensure(sizeof(record));
+            e.id = h.read_le<std::uint64_t>();
+            e.a = h.read_le<std::uint32_t>();
+            e.b = h.read_le<std::uint32_t>();
+        }
+
+        std::uint64_t sum = 0;
+        for (const record& e : records) sum += e.a;
+        benchmark::DoNotOptimize(sum);
+    }
+    set_processed(state);
+}
+
+// mapping the file and checking its header, then using every record
+void load_array_file_header(benchmark::State& state)
+{
+    const records_file file{state};
+    for (auto _ : state)
+    {
+        const gsl::array_file<record> records{file.path(), gsl::array_file_check::header};
+        std::uint64_t sum = 0;
+        for (const record& e : records.elements()) sum += e.a;
+        benchmark::DoNotOptimize(sum);
+    }
+    set_processed(state);
+}
+
+// mapping the file and checking its header and payload, then using every record
+void load_array_file_payload(benchmark::State& state)
+{
+    const records_file file{state};
+    for (auto _ : state)
+    {
+        const gsl::array_file<record> records{file.path(), gsl::array_file_check::payload};
+        std::uint64_t sum = 0;
+        for (const record& e : records.elements()) sum += e.a;
+        benchmark::DoNotOptimize(sum);
+    }
+    set_processed(state);
+}
+
+// mapping the file and checking its header, then using one record: the time to start up
+void open_array_file_header(benchmark::State& state)
+{
+    const records_file file{state};
+    for (auto _ : state)
+    {
+        const gsl::array_file<record> records{file.path(), gsl::array_file_check::header};
+        benchmark::DoNotOptimize(records.elements()[records.size() / 2].a);
+    }
+    set_processed(state);
+}
+} // namespace
+
+BENCHMARK(load_parse)->GSL_BENCHMARK_SIZES;
+BENCHMARK(load_array_file_header)->GSL_BENCHMARK_SIZES;
+BENCHMARK(load_array_file_payload)->GSL_BENCHMARK_SIZES;
+BENCHMARK(open_array_file_header)->GSL_BENCHMARK_SIZES;
+
+#endif // defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Span heavy functions whose object code gsl_contract_size compares between the
+// out of line contract failure handler and a failure path inlined at every site.
+
+#include <gsl/assert>
+
+#if defined(GSL_BENCHMARK_INLINE_CONTRACT_FAILURE)
+// the failure path before it was moved out of line
+#undef GSL_CONTRACT_CHECK_DETAIL
+#define GSL_CONTRACT_CHECK_DETAIL(type, cond)                                                      \
+    (GSL_LIKELY(cond) ? static_cast<void>(0) : gsl::details::terminate())
+#endif // defined(GSL_BENCHMARK_INLINE_CONTRACT_FAILURE)
+
+#include <gsl/algorithm> // for copy
+#include <gsl/span>      // for span, as_bytes
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint8_t, uint32_t
+
+namespace gsl_codegen
+{
+int sum_indexed(gsl::span<const int> s, std::size_t n)
+{
+    int sum = 0;
+    for (std::size_t i = 0; i < n; ++i) sum += s[i];
+    return sum;
+}
+
+int sum_iterated(gsl::span<const int> s)
+{
+    int sum = 0;
+    for (const int x : s) sum += x;
+    return sum;
+}
+
+int sum_strided(gsl::span<const int> s, std::size_t stride)
+{
+    int sum = 0;
+    for (auto it = s.begin(); it < s.end(); it += static_cast<std::ptrdiff_t>(stride)) sum += *it;
+    return sum;
+}
+
+int ends(gsl::span<const int> s) { return s.front() + s.back(); }
+
+std::uint32_t read_u32(gsl::span<const std::uint8_t> s, std::size_t offset)
+{
+    const auto b = s.subspan(offset, 4);
+    return std::uint32_t{b[0]} | std::uint32_t{b[1]} << 8 | std::uint32_t{b[2]} << 16 |
+           std::uint32_t{b[3]} << 24;
+}
+
+std::size_t parse_records(gsl::span<const std::uint8_t> s)
+{
+    std::size_t records = 0;
+    while (!s.empty())
+    {
+        const std::size_t length = s[0];
+        const auto record = s.subspan(1, length);
+        records += record.empty() ? 0u : record.last(1)[0];
+        s = s.subspan(1 + length);
+    }
+    return records;
+}
+
+void blit(gsl::span<const float> src, gsl::span<float> dest, std::size_t row, std::size_t width)
+{
+    gsl::copy(src.subspan(row * width, width), dest.subspan(row * width, width));
+}
+
+float dot(gsl::span<const float> a, gsl::span<const float> b)
+{
+    float sum = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) sum += a[i] * b[i];
+    return sum;
+}
+
+void saxpy(float alpha, gsl::span<const float> x, gsl::span<float> y)
+{
+    for (std::size_t i = 0; i < x.size(); ++i) y[i] += alpha * x[i];
+}
+
+int matrix_at(gsl::span<const int> m, std::size_t columns, std::size_t r, std::size_t c)
+{
+    return m.subspan(r * columns).first(columns)[c];
+}
+
+int fixed_window(gsl::span<const int> s, std::size_t offset)
+{
+    const gsl::span<const int, 4> window{s.subspan(offset, 4)};
+    return window[0] + window[1] + window[2] + window[3];
+}
+
+std::size_t byte_checksum(gsl::span<const int> s)
+{
+    std::size_t sum = 0;
+    for (const auto b : gsl::as_bytes(s)) sum += static_cast<std::size_t>(b);
+    return sum;
+}
+
+int lookup(gsl::span<const int> table, gsl::span<const std::uint8_t> keys)
+{
+    int result = 0;
+    for (const auto k : keys) result ^= table[k];
+    return result;
+}
+
+gsl::span<const int> split_at(gsl::span<const int> s, std::size_t n, gsl::span<const int>& rest)
+{
+    rest = s.last(s.size() - n);
+    return s.first(n);
+}
+} // namespace gsl_codegen
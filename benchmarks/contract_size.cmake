@@ -0,0 +1,52 @@
+# Prints the hot (.text) and cold (.text.unlikely) code size of the OUT_OF_LINE and
+# INLINE objects built from contract_codegen.cpp, as reported by OBJDUMP, and fails if
+# the out of line handler makes the hot code more than MAX_HOT_GROWTH bytes larger.
+
+if (NOT OBJDUMP)
+    message(FATAL_ERROR "objdump is required to measure the code size")
+endif()
+if (NOT DEFINED MAX_HOT_GROWTH)
+    set(MAX_HOT_GROWTH 0)
+endif()
+
+function(section_sizes object hot_var cold_var)
+    execute_process(
+        COMMAND ${OBJDUMP} -h ${object}
+        OUTPUT_VARIABLE headers
+        RESULT_VARIABLE result
+    )
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${OBJDUMP} -h ${object} failed")
+    endif()
+
+    set(hot 0)
+    set(cold 0)
+    string(REGEX MATCHALL "[0-9]+ +\\.text[^ ]* +[0-9a-fA-F]+" sections "${headers}")
+    foreach(section IN LISTS sections)
+        string(REGEX REPLACE "[0-9]+ +(\\.text[^ ]*) +([0-9a-fA-F]+)" "\\1;\\2" fields "${section}")
+        list(GET fields 0 name)
+        list(GET fields 1 size)
+        math(EXPR size "0x${size}")
+        if (name MATCHES "^\\.text\\.unlikely")
+            math(EXPR cold "${cold} + ${size}")
+        else()
+            math(EXPR hot "${hot} + ${size}")
+        endif()
+    endforeach()
+    set(${hot_var} ${hot} PARENT_SCOPE)
+    set(${cold_var} ${cold} PARENT_SCOPE)
+endfunction()
+
+section_sizes(${OUT_OF_LINE} out_of_line_hot out_of_line_cold)
+section_sizes(${INLINE} inline_hot inline_cold)
+math(EXPR hot_difference "${out_of_line_hot} - ${inline_hot}")
+
+message("contract failure path   hot bytes   cold bytes")
+message("out of line handler     ${out_of_line_hot}        ${out_of_line_cold}")
+message("inlined at each site    ${inline_hot}        ${inline_cold}")
+message("hot code difference     ${hot_difference}")
+
+if (hot_difference GREATER MAX_HOT_GROWTH)
+    message(FATAL_ERROR "the out of line contract failure handler adds ${hot_difference} bytes of hot "
+                        "code, more than the ${MAX_HOT_GROWTH} allowed")
+endif()
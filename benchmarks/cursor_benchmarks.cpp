@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <gsl/span>        // for span, as_bytes
+#include <gsl/span_cursor> // for span_reader
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint16_t, uint32_t, uint64_t
+#include <cstring> // for memcpy
+#include <vector>  // for vector
+
+// Buffers of 16 byte records, in bytes, from the L1 cache out to main memory.
+#define GSL_BENCHMARK_SIZES                                                                        \
+    Arg(16 << 10)->Arg(256 << 10)->Arg(4 << 20)->Arg(64 << 20)
+
+namespace
+{
+// a fixed header of four fields, the first three little-endian, the last one big-endian
+constexpr std::size_t record_size = 16;
+
+std::vector<unsigned char> make_records(const benchmark::State& state)
+{
+    std::vector<unsigned char> v(static_cast<std::size_t>(state.range(0)));
+    for (std::size_t i = 0; i < v.size(); ++i) v[i] = static_cast<unsigned char>(i * 7);
+    return v;
+}
+
+void set_processed(benchmark::State& state, std::size_t bytes)
+{
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(bytes));
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+// hand-written pointer arithmetic, assuming a little-endian host
+void decode_raw(benchmark::State& state)
+{
+    const auto v = make_records(state);
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        for (const unsigned char* p = v.data(); p != v.data() + v.size(); p += record_size)
+        {
+            std::uint32_t a;
+            std::uint16_t b;
+            std::uint16_t c;
+            std::uint64_t d;
+            std::memcpy(&a, p, 4);
+            std::memcpy(&b, p + 4, 2);
+            std::memcpy(&c, p + 6, 2);
+            std::memcpy(&d, p + 8, 8);
+            sum += a + b + c + __builtin_bswap64(d);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_processed(state, v.size());
+}
+#endif // defined(__GNUC__) || defined(__clang__)
+
+// one bounds check per field
+void decode_span_reader(benchmark::State& state)
+{
+    const auto v = make_records(state);
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        gsl::span_reader r{gsl::as_bytes(gsl::span<const unsigned char>{v})};
+        while (!r.empty())
+        {
+            sum += r.read_le<std::uint32_t>();
+            sum += r.read_le<std::uint16_t>();
+            sum += r.read_le<std::uint16_t>();
+            sum += r.read_be<std::uint64_t>();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_processed(state, v.size());
+}
+
+// one bounds check per record
+void decode_span_reader_ensure(benchmark::State& state)
+{
+    const auto v = make_records(state);
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0;
+        gsl::span_reader r{gsl::as_bytes(gsl::span<const unsigned char>{v})};
+        while (!r.empty())
+        {
+            gsl::span_reader h = r.ensure(record_size);
+            sum += h.read_le<std::uint32_t>();
+            sum += h.read_le<std::uint16_t>();
+            sum += h.read_le<std::uint16_t>();
+            sum += h.read_be<std::uint64_t>();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    set_processed(state, v.size());
+}
+} // namespace
+
+#if defined(__GNUC__) || defined(__clang__)
+BENCHMARK(decode_raw)->GSL_BENCHMARK_SIZES;
+#endif // defined(__GNUC__) || defined(__clang__)
+BENCHMARK(decode_span_reader)->GSL_BENCHMARK_SIZES;
+BENCHMARK(decode_span_reader_ensure)->GSL_BENCHMARK_SIZES;
@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <gsl/sorted_span> // for sorted_span, eytzinger_layout
+#include <gsl/span>        // for span
+
+#include <algorithm> // for lower_bound
+#include <cstddef>   // for size_t
+#include <cstdint>   // for int32_t, int64_t, uint32_t
+#include <vector>    // for vector
+
+// The same table sizes, in bytes, as the span benchmarks: from the L1 cache out to main memory.
+#define GSL_BENCHMARK_SIZES                                                                        \
+    Arg(16 << 10)->Arg(256 << 10)->Arg(4 << 20)->Arg(64 << 20)
+
+namespace
+{
+constexpr std::size_t lookups = 1 << 12;
+
+std::vector<std::int32_t> make_table(const benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0)) / sizeof(std::int32_t);
+    std::vector<std::int32_t> v(count);
+    for (std::size_t i = 0; i < count; ++i) v[i] = static_cast<std::int32_t>(2 * i);
+    return v;
+}
+
+// keys spread over the whole table, in an order the branch predictor cannot learn
+std::vector<std::int32_t> make_keys(std::size_t count)
+{
+    std::vector<std::int32_t> keys(lookups);
+    std::uint32_t x = 2463534242u;
+    for (auto& k : keys)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        k = static_cast<std::int32_t>(x % (2 * count));
+    }
+    return keys;
+}
+
+void set_processed(benchmark::State& state)
+{
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(lookups));
+}
+
+void search_std_lower_bound(benchmark::State& state)
+{
+    const auto v = make_table(state);
+    const auto keys = make_keys(v.size());
+    const gsl::span<const std::int32_t> s{v};
+    for (auto _ : state)
+    {
+        for (const std::int32_t key : keys)
+            benchmark::DoNotOptimize(std::lower_bound(s.begin(), s.end(), key));
+    }
+    set_processed(state);
+}
+
+void search_sorted_span(benchmark::State& state)
+{
+    const auto v = make_table(state);
+    const auto keys = make_keys(v.size());
+    const gsl::sorted_span<const std::int32_t> s{gsl::span<const std::int32_t>{v}};
+    for (auto _ : state)
+    {
+        for (const std::int32_t key : keys) benchmark::DoNotOptimize(s.lower_bound(key));
+    }
+    set_processed(state);
+}
+
+void search_eytzinger(benchmark::State& state)
+{
+    const auto v = make_table(state);
+    const auto keys = make_keys(v.size());
+    const gsl::eytzinger_layout<const std::int32_t> e{
+        gsl::sorted_span<const std::int32_t>{gsl::span<const std::int32_t>{v}}};
+    for (auto _ : state)
+    {
+        for (const std::int32_t key : keys) benchmark::DoNotOptimize(e.lower_bound(key));
+    }
+    set_processed(state);
+}
+} // namespace
+
+BENCHMARK(search_std_lower_bound)->GSL_BENCHMARK_SIZES;
+BENCHMARK(search_sorted_span)->GSL_BENCHMARK_SIZES;
+BENCHMARK(search_eytzinger)->GSL_BENCHMARK_SIZES;
@@ -0,0 +1,400 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <gsl/algorithm> // for copy
+#include <gsl/soa>       // for soa_vector
+#include <gsl/span>      // for span
+#include <gsl/zip>       // for zip
+
+#include <algorithm> // for copy_n
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint8_t, int32_t
+#include <tuple>     // for get
+#include <vector>    // for vector
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+#include <span>
+#define GSL_BENCHMARK_STD_SPAN
+#endif
+
+// Every benchmark is run over the same set of buffer sizes, in bytes, so the
+// working set moves from the L1 cache out to main memory.
+#define GSL_BENCHMARK_SIZES                                                                        \
+    Arg(16 << 10)->Arg(256 << 10)->Arg(4 << 20)->Arg(64 << 20)
+
+namespace
+{
+constexpr std::size_t block_size = 64;
+
+template <class T>
+std::vector<T> make_buffer(const benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0)) / sizeof(T);
+    return std::vector<T>(count, T{1});
+}
+
+template <class T>
+void set_processed(benchmark::State& state, std::size_t count, std::size_t passes = 1)
+{
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(count * sizeof(T) * passes));
+}
+
+//
+// range-for over the span iterator
+//
+template <class T>
+void iterate_raw(benchmark::State& state)
+{
+    auto v = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        T* const first = v.data();
+        T* const last = first + v.size();
+        for (T* p = first; p != last; ++p) *p = static_cast<T>(*p + 1);
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, v.size());
+}
+
+template <class T>
+void iterate_gsl_span(benchmark::State& state)
+{
+    auto v = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        const gsl::span<T> s{v};
+        for (T& x : s) x = static_cast<T>(x + 1);
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, v.size());
+}
+
+#ifdef GSL_BENCHMARK_STD_SPAN
+template <class T>
+void iterate_std_span(benchmark::State& state)
+{
+    auto v = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        const std::span<T> s{v};
+        for (T& x : s) x = static_cast<T>(x + 1);
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, v.size());
+}
+#endif // GSL_BENCHMARK_STD_SPAN
+
+//
+// indexed access through operator[]
+//
+template <class T>
+void index_raw(benchmark::State& state)
+{
+    auto v = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        T* const p = v.data();
+        const std::size_t n = v.size();
+        for (std::size_t i = 0; i < n; ++i) p[i] = static_cast<T>(p[i] + 1);
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, v.size());
+}
+
+template <class T>
+void index_gsl_span(benchmark::State& state)
+{
+    auto v = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        const gsl::span<T> s{v};
+        for (std::size_t i = 0; i < s.size(); ++i) s[i] = static_cast<T>(s[i] + 1);
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, v.size());
+}
+
+template <class T>
+void index_gsl_span_indices(benchmark::State& state)
+{
+    auto v = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        const gsl::span<T> s{v};
+        for (const auto i : s.indices()) s[i] = static_cast<T>(s[i] + 1);
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, v.size());
+}
+
+#ifdef GSL_BENCHMARK_STD_SPAN
+template <class T>
+void index_std_span(benchmark::State& state)
+{
+    auto v = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        const std::span<T> s{v};
+        for (std::size_t i = 0; i < s.size(); ++i) s[i] = static_cast<T>(s[i] + 1);
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, v.size());
+}
+#endif // GSL_BENCHMARK_STD_SPAN
+
+//
+// element-wise kernel over several buffers, out = a * b + c
+//
+template <class T>
+void kernel_raw(benchmark::State& state)
+{
+    auto out = make_buffer<T>(state);
+    const auto a = make_buffer<T>(state);
+    const auto b = make_buffer<T>(state);
+    const auto c = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        T* const o = out.data();
+        const T* const pa = a.data();
+        const T* const pb = b.data();
+        const T* const pc = c.data();
+        const std::size_t n = out.size();
+        for (std::size_t i = 0; i < n; ++i) o[i] = static_cast<T>(pa[i] * pb[i] + pc[i]);
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, out.size(), 4);
+}
+
+template <class T>
+void kernel_gsl_span(benchmark::State& state)
+{
+    auto out = make_buffer<T>(state);
+    const auto a = make_buffer<T>(state);
+    const auto b = make_buffer<T>(state);
+    const auto c = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        const gsl::span<T> o{out};
+        const gsl::span<const T> sa{a};
+        const gsl::span<const T> sb{b};
+        const gsl::span<const T> sc{c};
+        for (std::size_t i = 0; i < o.size(); ++i) o[i] = static_cast<T>(sa[i] * sb[i] + sc[i]);
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, out.size(), 4);
+}
+
+template <class T>
+void kernel_gsl_zip(benchmark::State& state)
+{
+    auto out = make_buffer<T>(state);
+    const auto a = make_buffer<T>(state);
+    const auto b = make_buffer<T>(state);
+    const auto c = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        for (auto&& e : gsl::zip(gsl::span<T>{out}, gsl::span<const T>{a}, gsl::span<const T>{b},
+                                 gsl::span<const T>{c}))
+        {
+            std::get<0>(e) = static_cast<T>(std::get<1>(e) * std::get<2>(e) + std::get<3>(e));
+        }
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, out.size(), 4);
+}
+
+//
+// summing one field of a four field record, stored as array-of-structs and as struct-of-arrays
+//
+template <class T>
+struct record
+{
+    T a;
+    T b;
+    T c;
+    T d;
+};
+
+template <class T>
+void scan_aos(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0)) / sizeof(record<T>);
+    const std::vector<record<T>> v(count, record<T>{T{1}, T{2}, T{3}, T{4}});
+    for (auto _ : state)
+    {
+        T sum{};
+        for (const record<T>& r : gsl::span<const record<T>>{v}) sum = static_cast<T>(sum + r.b);
+        benchmark::DoNotOptimize(sum);
+    }
+    set_processed<T>(state, count);
+}
+
+template <class T>
+void scan_soa(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0)) / sizeof(record<T>);
+    gsl::soa_vector<T, T, T, T> v(count);
+    for (auto _ : state)
+    {
+        T sum{};
+        for (const T x : v.template column<1>()) sum = static_cast<T>(sum + x);
+        benchmark::DoNotOptimize(sum);
+    }
+    set_processed<T>(state, count);
+}
+
+//
+// walking the buffer in blocks through subspan/first/last chains
+//
+template <class T>
+void subview_raw(benchmark::State& state)
+{
+    auto v = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        T* const p = v.data();
+        const std::size_t n = v.size() - v.size() % block_size;
+        for (std::size_t off = 0; off < n; off += block_size)
+        {
+            T* const blk = p + off;
+            blk[0] = static_cast<T>(blk[0] + 1);
+            blk[block_size - 1] = static_cast<T>(blk[block_size - 1] + 1);
+        }
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, v.size() / block_size * 2);
+}
+
+template <class T>
+void subview_gsl_span(benchmark::State& state)
+{
+    auto v = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        const gsl::span<T> s{v};
+        const std::size_t n = s.size() - s.size() % block_size;
+        for (std::size_t off = 0; off < n; off += block_size)
+        {
+            const auto blk = s.subspan(off).first(block_size);
+            auto& head = blk.template first<1>()[0];
+            auto& tail = blk.template last<1>()[0];
+            head = static_cast<T>(head + 1);
+            tail = static_cast<T>(tail + 1);
+        }
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, v.size() / block_size * 2);
+}
+
+#ifdef GSL_BENCHMARK_STD_SPAN
+template <class T>
+void subview_std_span(benchmark::State& state)
+{
+    auto v = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        const std::span<T> s{v};
+        const std::size_t n = s.size() - s.size() % block_size;
+        for (std::size_t off = 0; off < n; off += block_size)
+        {
+            const auto blk = s.subspan(off).first(block_size);
+            auto& head = blk.template first<1>()[0];
+            auto& tail = blk.template last<1>()[0];
+            head = static_cast<T>(head + 1);
+            tail = static_cast<T>(tail + 1);
+        }
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, v.size() / block_size * 2);
+}
+#endif // GSL_BENCHMARK_STD_SPAN
+
+//
+// bulk copies
+//
+template <class T>
+void copy_raw(benchmark::State& state)
+{
+    const auto src = make_buffer<T>(state);
+    auto dst = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        std::copy_n(src.data(), src.size(), dst.data());
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, src.size(), 2);
+}
+
+template <class T>
+void copy_gsl_span(benchmark::State& state)
+{
+    const auto src = make_buffer<T>(state);
+    auto dst = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        gsl::copy(gsl::span<const T>{src}, gsl::span<T>{dst});
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, src.size(), 2);
+}
+
+#ifdef GSL_BENCHMARK_STD_SPAN
+template <class T>
+void copy_std_span(benchmark::State& state)
+{
+    const auto src = make_buffer<T>(state);
+    auto dst = make_buffer<T>(state);
+    for (auto _ : state)
+    {
+        const std::span<const T> s{src};
+        const std::span<T> d{dst};
+        std::copy(s.begin(), s.end(), d.begin());
+        benchmark::ClobberMemory();
+    }
+    set_processed<T>(state, src.size(), 2);
+}
+#endif // GSL_BENCHMARK_STD_SPAN
+} // namespace
+
+#define GSL_BENCHMARK_TYPES(name)                                                                  \
+    BENCHMARK_TEMPLATE(name, std::uint8_t)->GSL_BENCHMARK_SIZES;                                   \
+    BENCHMARK_TEMPLATE(name, std::int32_t)->GSL_BENCHMARK_SIZES;                                   \
+    BENCHMARK_TEMPLATE(name, double)->GSL_BENCHMARK_SIZES
+
+GSL_BENCHMARK_TYPES(iterate_raw);
+GSL_BENCHMARK_TYPES(iterate_gsl_span);
+GSL_BENCHMARK_TYPES(index_raw);
+GSL_BENCHMARK_TYPES(index_gsl_span);
+GSL_BENCHMARK_TYPES(index_gsl_span_indices);
+GSL_BENCHMARK_TYPES(kernel_raw);
+GSL_BENCHMARK_TYPES(kernel_gsl_span);
+GSL_BENCHMARK_TYPES(kernel_gsl_zip);
+GSL_BENCHMARK_TYPES(scan_aos);
+GSL_BENCHMARK_TYPES(scan_soa);
+GSL_BENCHMARK_TYPES(subview_raw);
+GSL_BENCHMARK_TYPES(subview_gsl_span);
+GSL_BENCHMARK_TYPES(copy_raw);
+GSL_BENCHMARK_TYPES(copy_gsl_span);
+
+#ifdef GSL_BENCHMARK_STD_SPAN
+GSL_BENCHMARK_TYPES(iterate_std_span);
+GSL_BENCHMARK_TYPES(index_std_span);
+GSL_BENCHMARK_TYPES(subview_std_span);
+GSL_BENCHMARK_TYPES(copy_std_span);
+#endif // GSL_BENCHMARK_STD_SPAN
@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <gsl/vectored_io> // for gather, pwrite_all
+
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+
+#include <gsl/span> // for span
+
+#include <cstddef> // for size_t
+#include <cstdlib> // for mkstemp
+#include <cstring> // for memcpy
+#include <string>  // for string
+#include <vector>  // for vector
+
+#include <unistd.h> // for pwrite, close, unlink
+
+// Response bodies, in bytes, from a small message up to a large one
+#define GSL_BENCHMARK_SIZES Arg(4 << 10)->Arg(64 << 10)->Arg(1 << 20)
+
+namespace
+{
+// a response of a 64 byte header, a body and a 16 byte trailer, written to a file that stays in
+// the page cache
+class response
+{
+public:
+    explicit response(const benchmark::State& state)
+        : header(64, 'h'), body(static_cast<std::size_t>(state.range(0)), 'b'), trailer(16, 't'),
+          path_("/tmp/gsl_benchmark_XXXXXX")
+    {
+        fd_ = ::mkstemp(&path_[0]);
+    }
+
+    response(const response&) = delete;
+    response& operator=(const response&) = delete;
+
+    ~response()
+    {
+        ::close(fd_);
+        ::unlink(path_.c_str());
+    }
+
+    int fd() const { return fd_; }
+
+    std::size_t size() const { return header.size() + body.size() + trailer.size(); }
+
+    std::vector<char> header;
+    std::vector<char> body;
+    std::vector<char> trailer;
+
+private:
+    std::string path_;
+    int fd_;
+};
+
+void set_processed(benchmark::State& state, std::size_t bytes)
+{
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(bytes));
+}
+
+// the parts copied into one buffer, then written with one call
+void write_copied(benchmark::State& state)
+{
+    const response r{state};
+    std::vector<char> buffer;
+    for (auto _ : state)
+    {
+        buffer.resize(r.size());
+        std::memcpy(buffer.data(), r.header.data(), r.header.size());
+        std::memcpy(buffer.data() + r.header.size(), r.body.data(), r.body.size());
+        std::memcpy(buffer.data() + r.header.size() + r.body.size(), r.trailer.data(),
+                    r.trailer.size());
+        benchmark::DoNotOptimize(::pwrite(r.fd(), buffer.data(), buffer.size(), 0));
+    }
+    set_processed(state, r.size());
+}
+
+// the parts written where they are, with one pwritev
+void write_gathered(benchmark::State& state)
+{
+    const response r{state};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(gsl::pwrite_all(
+            r.fd(), 0,
+            gsl::gather(gsl::make_span(r.header), gsl::make_span(r.body),
+                        gsl::make_span(r.trailer))));
+    }
+    set_processed(state, r.size());
+}
+} // namespace
+
+BENCHMARK(write_copied)->GSL_BENCHMARK_SIZES;
+BENCHMARK(write_gathered)->GSL_BENCHMARK_SIZES;
+
+#endif // defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
@@ -14,11 +14,14 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>     // for all_of, equal
 #include <array>         // for array
-#include <cstddef>       // for size_t
+#include <cstddef>       // for ptrdiff_t, size_t
 #include <gsl/algorithm> // for copy
 #include <gsl/span>      // for span
 #include <gtest/gtest.h>
+#include <string>        // for string
+#include <vector>        // for vector
 
 #include "deathTestCommon.h"
 
@@ -179,6 +182,154 @@ TEST(algorithm_tests, compatible_type)
     }
 }
 
+TEST(algorithm_tests, non_trivial_type)
+{
+    std::array<std::string, 3> src{"a", "bb", "ccc"};
+    std::array<std::string, 4> dst{};
+
+    copy(span<const std::string>(src), span<std::string>(dst));
+
+    EXPECT_TRUE(dst[0] == "a");
+    EXPECT_TRUE(dst[2] == "ccc");
+    EXPECT_TRUE(dst[3].empty());
+}
+
+TEST(algorithm_tests, overlapping_spans)
+{
+    std::array<int, 6> a{1, 2, 3, 4, 5, 6};
+    const span<int> s{a};
+
+    // destination starts before the source, as allowed for std::copy_n
+    copy(s.subspan(2), s);
+
+    const std::array<int, 6> expected{3, 4, 5, 6, 5, 6};
+    EXPECT_TRUE(a == expected);
+}
+
+TEST(algorithm_tests, large_copy)
+{
+    // larger than GSL_NONTEMPORAL_COPY_THRESHOLD, with a misaligned destination and an odd tail
+    const std::size_t count = (GSL_NONTEMPORAL_COPY_THRESHOLD / sizeof(int)) + 37;
+    std::vector<int> src(count);
+    for (std::size_t i = 0; i < count; ++i) src[i] = static_cast<int>(i);
+    std::vector<unsigned char> dst_bytes(count + 5, 0xAB);
+    std::vector<int> dst(count + 3, -1);
+
+    copy(span<const int>(src), span<int>(dst).subspan(1));
+    EXPECT_TRUE(dst[0] == -1);
+    EXPECT_TRUE(std::equal(src.begin(), src.end(), dst.begin() + 1));
+    EXPECT_TRUE(dst[count + 1] == -1 && dst[count + 2] == -1);
+
+    std::vector<unsigned char> src_bytes(count);
+    for (std::size_t i = 0; i < count; ++i) src_bytes[i] = static_cast<unsigned char>(i % 251);
+    copy(span<const unsigned char>(src_bytes), span<unsigned char>(dst_bytes).subspan(3));
+    EXPECT_TRUE(dst_bytes[2] == 0xAB);
+    EXPECT_TRUE(std::equal(src_bytes.begin(), src_bytes.end(), dst_bytes.begin() + 3));
+    EXPECT_TRUE(dst_bytes[count + 3] == 0xAB && dst_bytes[count + 4] == 0xAB);
+}
+
+TEST(algorithm_tests, small_copies)
+{
+    // every size around the 16 byte alignment and 64 byte block boundaries at every alignment,
+    // which also goes through the non-temporal path when the threshold is set low
+    std::array<unsigned char, 160> src{};
+    for (std::size_t i = 0; i < src.size(); ++i) src[i] = static_cast<unsigned char>(i + 1);
+    for (std::size_t size = 0; size <= 130; ++size)
+    {
+        for (std::size_t offset = 0; offset < 16; ++offset)
+        {
+            std::array<unsigned char, 160> dst{};
+            dst.fill(0xAB);
+            copy(span<const unsigned char>(src).first(size),
+                 span<unsigned char>(dst).subspan(offset, size));
+            EXPECT_TRUE(std::equal(src.begin(), src.begin() + static_cast<std::ptrdiff_t>(size),
+                                   dst.begin() + static_cast<std::ptrdiff_t>(offset)));
+            EXPECT_TRUE(std::all_of(dst.begin() + static_cast<std::ptrdiff_t>(offset + size),
+                                    dst.end(), [](unsigned char c) { return c == 0xAB; }));
+        }
+    }
+}
+
+TEST(algorithm_tests, fill)
+{
+    std::array<int, 5> a{};
+    gsl::fill(span<int>(a).subspan(1, 3), 7);
+    const std::array<int, 5> expected{0, 7, 7, 7, 0};
+    EXPECT_TRUE(a == expected);
+
+    gsl::fill(span<int, 5>(a), 1);
+    EXPECT_TRUE(gsl::count(span<const int>(a), 1) == 5);
+}
+
+TEST(algorithm_tests, move)
+{
+    std::array<std::string, 2> src{"first", "second"};
+    std::array<std::string, 3> dst{};
+
+    gsl::move(span<std::string, 2>(src), span<std::string, 3>(dst));
+    EXPECT_TRUE(dst[0] == "first");
+    EXPECT_TRUE(dst[1] == "second");
+    EXPECT_TRUE(dst[2].empty());
+}
+
+TEST(algorithm_tests, transform)
+{
+    std::array<short, 4> src{1, 2, 3, 4};
+    std::array<int, 4> dst{};
+
+    gsl::transform(span<const short>(src), span<int>(dst), [](short x) { return x * 10; });
+    const std::array<int, 4> expected{10, 20, 30, 40};
+    EXPECT_TRUE(dst == expected);
+}
+
+TEST(algorithm_tests, equal)
+{
+    std::array<int, 4> a{1, 2, 3, 4};
+    std::array<long, 4> b{1, 2, 3, 4};
+    std::array<int, 3> c{1, 2, 3};
+
+    EXPECT_TRUE(gsl::equal(span<int>(a), span<long>(b)));
+    EXPECT_TRUE(gsl::equal(span<int, 4>(a), span<long, 4>(b)));
+    EXPECT_FALSE(gsl::equal(span<int, 4>(a), span<int, 3>(c)));
+    EXPECT_FALSE(gsl::equal(span<int>(a), span<int>(c)));
+    EXPECT_TRUE(gsl::equal(span<int>(a).first(3), span<int>(c)));
+
+    b[3] = 5;
+    EXPECT_FALSE(gsl::equal(span<int>(a), span<long>(b)));
+    EXPECT_TRUE(gsl::equal(span<int>(), span<long>()));
+}
+
+TEST(algorithm_tests, find_and_count)
+{
+    std::array<int, 6> a{3, 1, 4, 1, 5, 9};
+    const span<int> s{a};
+
+    EXPECT_TRUE(gsl::find(s, 4) == s.begin() + 2);
+    EXPECT_TRUE(gsl::find(s, 2) == s.end());
+    EXPECT_TRUE(gsl::find(span<int>(), 2) == span<int>().end());
+    *gsl::find(s, 5) = 6;
+    EXPECT_TRUE(a[4] == 6);
+
+    EXPECT_TRUE(gsl::count(s, 1) == 2);
+    EXPECT_TRUE(gsl::count(s, 7) == 0);
+}
+
+TEST(algorithm_tests, small_destination_span_algorithms)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. small_destination_span_algorithms";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    std::array<int, 4> src{1, 2, 3, 4};
+    std::array<int, 2> dst{};
+
+    EXPECT_DEATH(gsl::move(span<int>(src), span<int>(dst)), expected);
+    EXPECT_DEATH(gsl::transform(span<int>(src), span<int>(dst), [](int x) { return x; }),
+                 expected);
+}
+
 #ifdef CONFIRM_COMPILATION_ERRORS
 TEST(algorithm_tests, incompatible_type)
 {
@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/aligned_span> // for aligned_span, make_aligned_span
+#include <gsl/span>         // for span
+
+#include <algorithm>   // for fill
+#include <cstdint>     // for int32_t
+#include <type_traits> // for is_same, is_convertible
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+struct alignas(64) buffer
+{
+    std::int32_t values[32];
+};
+} // namespace
+
+static_assert(sizeof(aligned_span<int, 16, 4>) == sizeof(int*),
+              "an aligned_span of static extent must be a single pointer");
+static_assert(std::is_convertible<aligned_span<int, 64>, aligned_span<const int, 16>>::value,
+              "a stronger alignment must convert to a weaker one");
+static_assert(!std::is_convertible<aligned_span<int, 16>, aligned_span<int, 64>>::value,
+              "a weaker alignment must not convert to a stronger one");
+static_assert(std::is_convertible<aligned_span<int, 16>, span<int>>::value,
+              "an aligned_span must convert to a span");
+static_assert(!std::is_convertible<span<int>, aligned_span<int, 16>>::value,
+              "making an aligned_span from a span must be explicit");
+
+TEST(aligned_span_tests, construction)
+{
+    buffer b{};
+    const span<std::int32_t> s{b.values};
+
+    const aligned_span<std::int32_t, 64> a{s};
+    EXPECT_TRUE(a.data() == b.values);
+    EXPECT_TRUE(a.size() == 32 && a.size_bytes() == sizeof(b.values));
+    EXPECT_FALSE(a.empty());
+
+    const auto m = make_aligned_span<32>(span<std::int32_t, 32>{b.values});
+    static_assert(std::is_same<decltype(m), const aligned_span<std::int32_t, 32, 32>>::value,
+                  "make_aligned_span must keep the extent");
+    EXPECT_TRUE(m.data() == b.values);
+
+    const aligned_span<const std::int32_t, 16> weaker = a;
+    EXPECT_TRUE(weaker.data() == b.values && weaker.size() == 32);
+
+    const aligned_span<std::int32_t, 16> from_pointer{b.values + 4, 8};
+    EXPECT_TRUE(from_pointer.size() == 8);
+
+    const aligned_span<std::int32_t, 64> empty;
+    EXPECT_TRUE(empty.empty() && empty.data() == nullptr);
+}
+
+TEST(aligned_span_tests, element_access)
+{
+    buffer b{};
+    const aligned_span<std::int32_t, 64> a{b.values};
+
+    std::int32_t i = 0;
+    for (std::int32_t& x : a) x = i++;
+    EXPECT_TRUE(a[5] == 5 && a.front() == 0 && a.back() == 31);
+    EXPECT_TRUE(*a.rbegin() == 31);
+
+    const span<std::int32_t> plain = a;
+    EXPECT_TRUE(plain.data() == b.values && plain.size() == 32);
+    std::fill(a.to_span().begin(), a.to_span().end(), 7);
+    EXPECT_TRUE(b.values[31] == 7);
+}
+
+TEST(aligned_span_tests, subspans)
+{
+    buffer b{};
+    const aligned_span<std::int32_t, 64, 32> a{span<std::int32_t, 32>{b.values}};
+
+    // 16 ints are 64 bytes, so the alignment is kept
+    const auto kept = a.subspan<16, 8>();
+    static_assert(std::is_same<decltype(kept), const aligned_span<std::int32_t, 64, 8>>::value,
+                  "an offset that is a multiple of the alignment must keep it");
+    EXPECT_TRUE(kept.data() == b.values + 16);
+
+    const auto lost = a.subspan<4>();
+    static_assert(std::is_same<decltype(lost), const span<std::int32_t, 28>>::value,
+                  "an offset that is not a multiple of the alignment must drop it");
+    EXPECT_TRUE(lost.data() == b.values + 4);
+
+    const auto prefix = a.first<8>();
+    static_assert(std::is_same<decltype(prefix), const aligned_span<std::int32_t, 64, 8>>::value,
+                  "a prefix must keep the alignment");
+    EXPECT_TRUE(a.first(3).size() == 3);
+
+    const auto runtime = a.aligned_subspan(16);
+    EXPECT_TRUE(runtime.data() == b.values + 16 && runtime.size() == 16);
+    EXPECT_TRUE(a.subspan(3, 2).data() == b.values + 3);
+    EXPECT_TRUE(a.last<2>().data() == b.values + 30 && a.last(5).size() == 5);
+}
+
+TEST(aligned_span_tests, alignment_is_checked)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. alignment_is_checked";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    buffer b{};
+    const span<std::int32_t> s{b.values};
+
+    EXPECT_DEATH((aligned_span<std::int32_t, 64>{s.subspan(1)}), expected);
+    EXPECT_DEATH(make_aligned_span<16>(s.subspan(2)), expected);
+
+    const aligned_span<std::int32_t, 64> a{s};
+    EXPECT_DEATH(a.aligned_subspan(4), expected);
+    EXPECT_DEATH(a[32], expected);
+    EXPECT_DEATH(a.first(33), expected);
+}
@@ -0,0 +1,298 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/array_file> // for array_file, write_array_file, array_file_errc
+
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+
+#include <gsl/span> // for span, as_bytes
+
+#include <algorithm>    // for min
+#include <csignal>      // for signal, SIGXFSZ, SIG_IGN
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int32_t, int64_t, uint16_t, uint64_t, uintptr_t
+#include <cstdlib>      // for mkstemp, _Exit
+#include <cstring>      // for strlen
+#include <string>       // for string
+#include <system_error> // for error_code, system_error, errc
+#include <utility>      // for move
+#include <vector>       // for vector
+
+#include <dirent.h>       // for opendir, readdir, closedir
+#include <fcntl.h>        // for open, O_WRONLY
+#include <sys/resource.h> // for setrlimit, RLIMIT_FSIZE
+#include <sys/stat.h>     // for chmod, stat
+#include <unistd.h>       // for pwrite, close, unlink, truncate
+
+using namespace gsl;
+
+namespace
+{
+struct record
+{
+    std::int32_t id;
+    std::uint16_t flags;
+    std::uint64_t value;
+};
+
+struct alignas(128) wide
+{
+    std::int64_t value;
+};
+
+// a unique path in the temporary directory, removed again by the destructor
+class temp_path
+{
+public:
+    temp_path() : path_(::testing::TempDir() + "gsl_array_file_XXXXXX")
+    {
+        const int fd = ::mkstemp(&path_[0]);
+        EXPECT_TRUE(fd != -1);
+        ::close(fd);
+    }
+
+    temp_path(const temp_path&) = delete;
+    temp_path& operator=(const temp_path&) = delete;
+
+    ~temp_path() { ::unlink(path_.c_str()); }
+
+    const char* get() const { return path_.c_str(); }
+
+    void patch(std::size_t offset, unsigned char value) const
+    {
+        const int fd = ::open(get(), O_WRONLY);
+        EXPECT_TRUE(::pwrite(fd, &value, 1, static_cast<off_t>(offset)) == 1);
+        ::close(fd);
+    }
+
+private:
+    std::string path_;
+};
+
+std::vector<record> make_records(std::size_t count)
+{
+    std::vector<record> v(count, record{});
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        v[i].id = static_cast<std::int32_t>(i);
+        v[i].flags = static_cast<std::uint16_t>(i * 3);
+        v[i].value = i * i;
+    }
+    return v;
+}
+
+bool same_records(span<const record> a, const std::vector<record>& b)
+{
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < b.size(); ++i)
+        if (a[i].id != b[i].id || a[i].flags != b[i].flags || a[i].value != b[i].value)
+            return false;
+    return true;
+}
+
+// Writes records to path with files limited to 1 KiB, and exits with 0 if that fails because
+// of the limit. Meant for a child process.
+void write_over_limit(const char* path, span<const record> records)
+{
+    std::signal(SIGXFSZ, SIG_IGN);
+    const rlimit limit{1024, 1024};
+    ::setrlimit(RLIMIT_FSIZE, &limit);
+    std::error_code ec;
+    write_array_file(path, records, ec);
+    std::_Exit(ec == std::errc::file_too_large ? 0 : 1);
+}
+
+std::uint64_t xxh64_of(const char* text)
+{
+    return details::xxh64_of(as_bytes(span<const char>{text, std::strlen(text)}));
+}
+} // namespace
+
+TEST(array_file_tests, checksum)
+{
+    EXPECT_TRUE(xxh64_of("") == 0xEF46DB3751D8E999);
+    EXPECT_TRUE(xxh64_of("Nobody inspects the spammish repetition") == 0xFBCEA83C8A378BF1);
+
+    // the hash does not depend on how the bytes are split up
+    std::vector<unsigned char> v(1000);
+    for (std::size_t i = 0; i < v.size(); ++i) v[i] = static_cast<unsigned char>(i * 13);
+    const auto bytes = as_bytes(span<const unsigned char>{v});
+    const std::uint64_t whole = details::xxh64_of(bytes);
+    for (const std::size_t piece : {std::size_t{1}, std::size_t{7}, std::size_t{32},
+                                    std::size_t{33}, std::size_t{100}, std::size_t{999}})
+    {
+        details::xxh64 hash;
+        for (std::size_t i = 0; i < bytes.size(); i += piece)
+            hash.update(bytes.subspan(i, std::min(piece, bytes.size() - i)));
+        EXPECT_TRUE(hash.digest() == whole);
+    }
+}
+
+TEST(array_file_tests, round_trip)
+{
+    const temp_path path;
+    const std::vector<record> records = make_records(10000);
+    write_array_file(path.get(), span<const record>{records});
+
+    const array_file<record> loaded{path.get()};
+    EXPECT_TRUE(loaded.size() == records.size() && !loaded.empty());
+    EXPECT_TRUE(same_records(loaded.elements(), records));
+    EXPECT_TRUE(loaded.file().file_size() == 64 + records.size() * sizeof(record));
+
+    const array_file<record> header_only{path.get(), array_file_check::header};
+    EXPECT_TRUE(same_records(header_only.elements(), records));
+
+    // the payload is aligned for the elements
+    std::vector<wide> wides(5);
+    for (std::size_t i = 0; i < wides.size(); ++i)
+        wides[i].value = -static_cast<std::int64_t>(i);
+    write_array_file(path.get(), make_span(wides));
+    const array_file<wide> loaded_wides{path.get()};
+    EXPECT_TRUE(loaded_wides.file().file_size() == 128 + 5 * sizeof(wide));
+    EXPECT_TRUE(reinterpret_cast<std::uintptr_t>(loaded_wides.elements().data()) % 128 == 0);
+    EXPECT_TRUE(loaded_wides.size() == 5 && loaded_wides.elements()[4].value == -4);
+
+    // no elements
+    write_array_file(path.get(), span<const record>{});
+    const array_file<record> none{path.get()};
+    EXPECT_TRUE(none.empty() && none.elements().empty());
+}
+
+TEST(array_file_tests, move)
+{
+    const temp_path path;
+    const std::vector<record> records = make_records(100);
+    write_array_file(path.get(), span<const record>{records});
+
+    array_file<record> first{path.get()};
+    array_file<record> second{std::move(first)};
+    EXPECT_TRUE(first.empty() && first.file().empty());
+    EXPECT_TRUE(same_records(second.elements(), records));
+
+    array_file<record> third;
+    third = std::move(second);
+    EXPECT_TRUE(second.empty() && same_records(third.elements(), records));
+}
+
+TEST(array_file_tests, replacing)
+{
+    const temp_path path;
+    const std::vector<record> old_records = make_records(100);
+    write_array_file(path.get(), span<const record>{old_records});
+    const array_file<record> old_file{path.get()};
+
+    // the mapping of the old file stays valid, and the new file has the old one's permissions
+    EXPECT_TRUE(::chmod(path.get(), 0640) == 0);
+    const std::vector<record> new_records = make_records(3000);
+    write_array_file(path.get(), span<const record>{new_records});
+    EXPECT_TRUE(same_records(old_file.elements(), old_records));
+    EXPECT_TRUE(same_records(array_file<record>{path.get()}.elements(), new_records));
+    struct stat status = {};
+    EXPECT_TRUE(::stat(path.get(), &status) == 0 && (status.st_mode & 07777) == 0640);
+
+    // a write that fails halfway, here at a file size limit, leaves the file alone
+    EXPECT_EXIT(write_over_limit(path.get(), span<const record>{old_records}),
+                ::testing::ExitedWithCode(0), "");
+    EXPECT_TRUE(same_records(old_file.elements(), old_records));
+    EXPECT_TRUE(same_records(array_file<record>{path.get()}.elements(), new_records));
+
+    // and no temporary file behind
+    const std::string file = path.get();
+    const std::string prefix = file.substr(file.rfind('/') + 1) + '.';
+    DIR* const dir = ::opendir(file.substr(0, file.rfind('/') + 1).c_str());
+    ASSERT_TRUE(dir != nullptr);
+    bool leftover = false;
+    while (const dirent* entry = ::readdir(dir))
+        leftover = leftover || std::string{entry->d_name}.compare(0, prefix.size(), prefix) == 0;
+    ::closedir(dir);
+    EXPECT_FALSE(leftover);
+
+    // a path without a directory is in the current one
+    const char* const relative = "gsl_array_file_relative";
+    std::error_code ec;
+    write_array_file(relative, span<const record>{old_records}, ec);
+    EXPECT_FALSE(ec);
+    EXPECT_TRUE(same_records(array_file<record>{relative}.elements(), old_records));
+    ::unlink(relative);
+}
+
+TEST(array_file_tests, rejected_files)
+{
+    const temp_path path;
+    const std::vector<record> records = make_records(100);
+    const auto write = [&] { write_array_file(path.get(), span<const record>{records}); };
+    const auto load_error = [&](array_file_check check) {
+        std::error_code ec;
+        const array_file<record> loaded{path.get(), check, ec};
+        EXPECT_TRUE(!ec || loaded.empty());
+        return ec;
+    };
+
+    write();
+    EXPECT_FALSE(load_error(array_file_check::payload));
+
+    // a payload byte
+    path.patch(64 + 10, 0xFF);
+    EXPECT_TRUE(load_error(array_file_check::payload) == array_file_errc::checksum_mismatch);
+    EXPECT_FALSE(load_error(array_file_check::header));
+
+    // the count
+    write();
+    path.patch(32, 0x01);
+    EXPECT_TRUE(load_error(array_file_check::header) == array_file_errc::checksum_mismatch);
+
+    write();
+    path.patch(0, 'g');
+    EXPECT_TRUE(load_error(array_file_check::header) == array_file_errc::not_an_array_file);
+
+    write();
+    path.patch(8, 2);
+    EXPECT_TRUE(load_error(array_file_check::header) == array_file_errc::unsupported_version);
+
+    write();
+    path.patch(12, 0xFF);
+    EXPECT_TRUE(load_error(array_file_check::header) == array_file_errc::wrong_byte_order);
+
+    write();
+    EXPECT_TRUE(::truncate(path.get(), static_cast<off_t>(64 + 99 * sizeof(record))) == 0);
+    EXPECT_TRUE(load_error(array_file_check::header) == array_file_errc::size_mismatch);
+
+    EXPECT_TRUE(::truncate(path.get(), 10) == 0);
+    EXPECT_TRUE(load_error(array_file_check::header) == array_file_errc::not_an_array_file);
+
+    write();
+    std::error_code ec;
+    const array_file<std::int64_t> other_type{path.get(), array_file_check::header, ec};
+    EXPECT_TRUE(ec == array_file_errc::wrong_element_type && other_type.empty());
+
+    const array_file<record> missing{"/nonexistent/gsl_array_file", array_file_check::header, ec};
+    EXPECT_TRUE(ec == std::errc::no_such_file_or_directory);
+
+    write_array_file("/nonexistent/gsl_array_file", span<const record>{records}, ec);
+    EXPECT_TRUE(ec == std::errc::no_such_file_or_directory);
+
+    EXPECT_THROW(array_file<std::int64_t>{path.get()}, std::system_error);
+    EXPECT_THROW(write_array_file("/nonexistent/gsl_array_file", span<const record>{records}),
+                 std::system_error);
+
+    const std::error_code mismatch = array_file_errc::checksum_mismatch;
+    EXPECT_TRUE(mismatch.category().name() == std::string{"gsl::array_file"});
+    EXPECT_TRUE(mismatch.message() == "array file checksum mismatch");
+}
+
+#endif // defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
@@ -15,7 +15,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "deathTestCommon.h"
-#include <gsl/assert> // for Ensures, Expects
+#include <gsl/assert> // for Ensures, Expects, EnsuresAudit, ExpectsAudit
 #include <gtest/gtest.h>
 
 using namespace gsl;
@@ -35,6 +35,14 @@ int g(int i)
     Ensures(i > 0 && i < 10);
     return i;
 }
+
+int audit_evaluations = 0;
+
+bool audited(bool result)
+{
+    ++audit_evaluations;
+    return result;
+}
 } // namespace
 
 TEST(assertion_tests, expects)
@@ -58,3 +66,12 @@ TEST(assertion_tests, ensures)
     EXPECT_TRUE(g(2) == 3);
     EXPECT_DEATH(g(9), GetExpectedDeathString(terminateHandler));
 }
+
+TEST(assertion_tests, audit_checks_are_not_evaluated_by_default)
+{
+    static_assert(GSL_CONTRACT_LEVEL == GSL_CONTRACT_LEVEL_DEFAULT, "tests use the default level");
+
+    ExpectsAudit(audited(false));
+    EnsuresAudit(audited(false));
+    EXPECT_TRUE(audit_evaluations == 0);
+}
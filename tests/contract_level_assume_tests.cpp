@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// The level must be the same in the whole program, so these tests are a program of their own,
+// built with GSL_CONTRACT_LEVEL=GSL_CONTRACT_LEVEL_ASSUME.
+
+#include <gsl/assert> // for Ensures, Expects, EnsuresAudit, ExpectsAudit
+#include <gtest/gtest.h>
+
+namespace
+{
+int audit_evaluations = 0;
+
+bool counted_audit(bool result)
+{
+    ++audit_evaluations;
+    return result;
+}
+
+int assumed(int i)
+{
+    Expects(i > 0);
+    const int result = i * 2;
+    Ensures(result > i);
+    return result;
+}
+
+// A failed assumption is undefined behavior, so only the audit checks, which this level
+// ignores, are given false conditions
+int audited(int i)
+{
+    ExpectsAudit(counted_audit(i > 0));
+    EnsuresAudit(counted_audit(i > 0));
+    return i;
+}
+
+constexpr int constant_assumed(int i)
+{
+    Expects(i > 0);
+    return i;
+}
+} // namespace
+
+TEST(contract_level_assume_tests, holding_conditions)
+{
+    EXPECT_TRUE(assumed(1) == 2);
+    EXPECT_TRUE(assumed(21) == 42);
+}
+
+TEST(contract_level_assume_tests, audit_checks_are_ignored)
+{
+    audit_evaluations = 0;
+    EXPECT_TRUE(audited(1) == 1);
+    EXPECT_TRUE(audited(0) == 0);
+    EXPECT_TRUE(audit_evaluations == 0);
+}
+
+TEST(contract_level_assume_tests, constant_evaluation)
+{
+    static_assert(constant_assumed(1) == 1,
+                  "assumed contracts stay usable in constant expressions");
+    EXPECT_TRUE(constant_assumed(2) == 2);
+}
@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// The level must be the same in the whole program, so these tests are a program of their own,
+// built with GSL_CONTRACT_LEVEL=GSL_CONTRACT_LEVEL_AUDIT.
+
+#include "deathTestCommon.h"
+#include <gsl/assert> // for Ensures, Expects, EnsuresAudit, ExpectsAudit
+#include <gtest/gtest.h>
+
+namespace
+{
+int audited_precondition(int i)
+{
+    ExpectsAudit(i > 0 && i < 10);
+    return i;
+}
+
+int audited_postcondition(int i)
+{
+    i++;
+    EnsuresAudit(i > 0 && i < 10);
+    return i;
+}
+
+int checked(int i)
+{
+    Expects(i > 0);
+    return i;
+}
+
+constexpr int constant_audited(int i)
+{
+    ExpectsAudit(i > 0);
+    return i;
+}
+} // namespace
+
+TEST(contract_level_audit_tests, audit_checks)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. audit_checks";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    EXPECT_TRUE(audited_precondition(2) == 2);
+    EXPECT_TRUE(audited_postcondition(2) == 3);
+    EXPECT_DEATH(audited_precondition(10), expected);
+    EXPECT_DEATH(audited_postcondition(9), expected);
+}
+
+TEST(contract_level_audit_tests, default_checks_stay_enabled)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. default_checks_stay_enabled";
+        std::abort();
+    });
+
+    EXPECT_TRUE(checked(1) == 1);
+    EXPECT_DEATH(checked(0), GetExpectedDeathString(terminateHandler));
+}
+
+TEST(contract_level_audit_tests, constant_evaluation)
+{
+    static_assert(constant_audited(1) == 1, "audit checks stay usable in constant expressions");
+    EXPECT_TRUE(constant_audited(2) == 2);
+}
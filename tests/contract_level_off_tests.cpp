@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// The level must be the same in the whole program, so these tests are a program of their own,
+// built with GSL_CONTRACT_LEVEL=GSL_CONTRACT_LEVEL_OFF.
+
+#include <gsl/assert> // for Ensures, Expects, EnsuresAudit, ExpectsAudit
+#include <gtest/gtest.h>
+
+namespace
+{
+int evaluations = 0;
+
+bool counted(bool result)
+{
+    ++evaluations;
+    return result;
+}
+
+int unchecked(int i)
+{
+    Expects(counted(i > 0));
+    ExpectsAudit(counted(i > 0));
+    Ensures(counted(i > 0));
+    EnsuresAudit(counted(i > 0));
+    return i;
+}
+
+constexpr int constant_unchecked(int i)
+{
+    Expects(i > 0);
+    return i;
+}
+} // namespace
+
+TEST(contract_level_off_tests, conditions_are_not_evaluated)
+{
+    evaluations = 0;
+    EXPECT_TRUE(unchecked(1) == 1);
+    EXPECT_TRUE(evaluations == 0);
+}
+
+TEST(contract_level_off_tests, failed_conditions_do_not_terminate)
+{
+    EXPECT_TRUE(unchecked(0) == 0);
+    EXPECT_TRUE(unchecked(-1) == -1);
+    EXPECT_TRUE(evaluations == 0);
+}
+
+TEST(contract_level_off_tests, constant_evaluation)
+{
+    static_assert(constant_unchecked(1) == 1,
+                  "unchecked contracts stay usable in constant expressions");
+    static_assert(constant_unchecked(0) == 0,
+                  "unchecked contracts do not fail constant expressions");
+    EXPECT_TRUE(constant_unchecked(2) == 2);
+}
@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Telemetry must be on in the whole program, so these tests are a program of their own, built
+// with GSL_CONTRACT_TELEMETRY and GSL_CONTRACT_TELEMETRY_MAX_SITES=64, few enough for the
+// tests to fill a thread's table.
+
+#include <gtest/gtest.h>
+
+#include <gsl/assert> // for Expects, Ensures, contract_telemetry_snapshot
+
+#include <cstring> // for strcmp
+#include <sstream> // for ostringstream
+#include <string>  // for string
+#include <thread>  // for thread
+#include <vector>  // for vector
+
+namespace
+{
+constexpr unsigned expects_line = __LINE__ + 3;
+int checked_increment(int i)
+{
+    Expects(i >= 0);
+    const int result = i + 1;
+    Ensures(result > i);
+    return result;
+}
+constexpr unsigned ensures_line = expects_line + 2;
+
+constexpr int constant_checked(int i)
+{
+    Expects(i > 0);
+    return i;
+}
+
+unsigned long long count_of(const char* kind, unsigned line)
+{
+    for (const auto& site : gsl::contract_telemetry_snapshot())
+    {
+        if (site.line == line && std::strcmp(site.kind, kind) == 0 &&
+            std::string(site.file).find("contract_telemetry_tests") != std::string::npos)
+            return site.count;
+    }
+    return 0;
+}
+} // namespace
+
+TEST(contract_telemetry_tests, counts_per_site)
+{
+    const auto expects_before = count_of("Precondition", expects_line);
+    const auto ensures_before = count_of("Postcondition", ensures_line);
+
+    for (int i = 0; i < 10; ++i) checked_increment(i);
+
+    EXPECT_TRUE(count_of("Precondition", expects_line) == expects_before + 10);
+    EXPECT_TRUE(count_of("Postcondition", ensures_line) == ensures_before + 10);
+}
+
+TEST(contract_telemetry_tests, merges_threads)
+{
+    const auto before = count_of("Precondition", expects_line);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([] {
+            for (int i = 0; i < 1000; ++i) checked_increment(i);
+        });
+
+    // counts of live threads are visible too, the exact value is only known once they exit
+    EXPECT_TRUE(count_of("Precondition", expects_line) >= before);
+
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_TRUE(count_of("Precondition", expects_line) == before + 4000);
+}
+
+TEST(contract_telemetry_tests, constant_evaluation_is_not_counted)
+{
+    static_assert(constant_checked(1) == 1, "contract checks stay usable in constant expressions");
+    EXPECT_TRUE(constant_checked(2) == 2);
+}
+
+TEST(contract_telemetry_tests, dump)
+{
+    checked_increment(0);
+
+    std::ostringstream os;
+    gsl::contract_telemetry_dump(os);
+
+    std::ostringstream expected;
+    expected << ':' << expects_line << " Precondition ";
+    EXPECT_TRUE(os.str().find(expected.str()) != std::string::npos);
+}
+
+TEST(contract_telemetry_tests, table_grows_up_to_the_limit)
+{
+    // a new thread starts without a table, and its sites beyond the limit count as untracked
+    std::thread thread{[] {
+        for (unsigned line = 1; line <= 100; ++line)
+            for (unsigned i = 0; i < line; ++i)
+                gsl::details::record_contract_check("Precondition", "table_test", line);
+    }};
+    thread.join();
+
+    unsigned long long tracked_sites = 0;
+    unsigned long long tracked = 0;
+    unsigned long long untracked = 0;
+    for (const auto& site : gsl::contract_telemetry_snapshot())
+    {
+        if (std::strcmp(site.file, "table_test") == 0)
+        {
+            EXPECT_TRUE(site.count == site.line);
+            ++tracked_sites;
+            tracked += site.count;
+        }
+        if (std::strcmp(site.kind, "Untracked") == 0) untracked += site.count;
+    }
+    EXPECT_TRUE(tracked_sites == 64);
+    EXPECT_TRUE(tracked + untracked == 100u * 101u / 2u);
+}
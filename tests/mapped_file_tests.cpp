@@ -0,0 +1,274 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/mapped_file> // for mapped_file, map_options, map_mode, map_advice
+
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+
+#include <gsl/span> // for span
+
+#include <cstddef>      // for size_t
+#include <cstdlib>      // for mkstemp
+#include <iostream>     // for cerr
+#include <string>       // for string
+#include <system_error> // for error_code, system_error, errc
+#include <utility>      // for move
+#include <vector>       // for vector
+
+#include <fcntl.h>  // for open, O_RDONLY
+#include <unistd.h> // for write, pread, close, unlink, sysconf
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+// a file in the temporary directory, removed again by the destructor
+class temp_file
+{
+public:
+    explicit temp_file(const std::vector<unsigned char>& contents)
+        : path_(::testing::TempDir() + "gsl_mapped_file_XXXXXX")
+    {
+        const int fd = ::mkstemp(&path_[0]);
+        EXPECT_TRUE(fd != -1);
+        const auto written = ::write(fd, contents.data(), contents.size());
+        EXPECT_TRUE(written == static_cast<ssize_t>(contents.size()));
+        ::close(fd);
+    }
+
+    temp_file(const temp_file&) = delete;
+    temp_file& operator=(const temp_file&) = delete;
+
+    ~temp_file() { ::unlink(path_.c_str()); }
+
+    const char* path() const { return path_.c_str(); }
+
+    // the byte at offset, read without going through a mapping
+    unsigned char at(std::size_t offset) const
+    {
+        const int fd = ::open(path(), O_RDONLY);
+        unsigned char value = 0;
+        EXPECT_TRUE(::pread(fd, &value, 1, static_cast<off_t>(offset)) == 1);
+        ::close(fd);
+        return value;
+    }
+
+private:
+    std::string path_;
+};
+
+std::size_t page_size() { return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)); }
+
+// the bytes i % 251, so that neighbouring pages differ
+std::vector<unsigned char> pattern(std::size_t size)
+{
+    std::vector<unsigned char> v(size);
+    for (std::size_t i = 0; i < size; ++i) v[i] = static_cast<unsigned char>(i % 251);
+    return v;
+}
+
+bool matches_pattern(span<const gsl::impl::byte> bytes, std::size_t offset)
+{
+    for (std::size_t i = 0; i < bytes.size(); ++i)
+        if (static_cast<unsigned char>(bytes[i]) != (offset + i) % 251) return false;
+    return true;
+}
+} // namespace
+
+TEST(mapped_file_tests, whole_file)
+{
+    const std::size_t size = 3 * page_size() + 17;
+    const temp_file file{pattern(size)};
+
+    const mapped_file mapped{file.path()};
+    EXPECT_TRUE(mapped.size() == size && !mapped.empty());
+    EXPECT_TRUE(mapped.offset() == 0 && mapped.file_size() == size);
+    EXPECT_FALSE(mapped.writable());
+    EXPECT_TRUE(mapped.bytes().size() == size);
+    EXPECT_TRUE(matches_pattern(mapped.bytes(), 0));
+}
+
+TEST(mapped_file_tests, windows)
+{
+    const std::size_t size = 4 * page_size();
+    const temp_file file{pattern(size)};
+
+    // a window that neither starts nor ends on a page boundary
+    map_options options;
+    options.offset = page_size() + 3;
+    options.length = page_size();
+    const mapped_file window{file.path(), options};
+    EXPECT_TRUE(window.size() == page_size() && window.offset() == page_size() + 3);
+    EXPECT_TRUE(window.file_size() == size);
+    EXPECT_TRUE(matches_pattern(window.bytes(), page_size() + 3));
+
+    // the rest of the file
+    options.length = dynamic_extent;
+    const mapped_file rest{file.path(), options};
+    EXPECT_TRUE(rest.size() == size - page_size() - 3);
+    EXPECT_TRUE(matches_pattern(rest.bytes(), page_size() + 3));
+
+    // walking a file window by window
+    std::size_t total = 0;
+    for (std::size_t offset = 0; offset < size; offset += 1000)
+    {
+        options.offset = offset;
+        options.length = size - offset < 1000 ? size - offset : 1000;
+        const mapped_file part{file.path(), options};
+        EXPECT_TRUE(matches_pattern(part.bytes(), offset));
+        total += part.size();
+    }
+    EXPECT_TRUE(total == size);
+
+    // empty windows and files map to empty spans
+    options.offset = size;
+    options.length = dynamic_extent;
+    const mapped_file at_end{file.path(), options};
+    EXPECT_TRUE(at_end.empty() && at_end.bytes().empty() && at_end.offset() == size);
+
+    const temp_file empty_file{{}};
+    const mapped_file none{empty_file.path()};
+    EXPECT_TRUE(none.empty() && none.file_size() == 0);
+}
+
+TEST(mapped_file_tests, errors)
+{
+    const temp_file file{pattern(100)};
+
+    std::error_code ec;
+    const mapped_file missing{"/nonexistent/gsl_mapped_file", {}, ec};
+    EXPECT_TRUE(ec == std::errc::no_such_file_or_directory);
+    EXPECT_TRUE(missing.empty());
+
+    map_options options;
+    options.offset = 101;
+    const mapped_file past_end{file.path(), options, ec};
+    EXPECT_TRUE(ec == std::errc::invalid_argument && past_end.empty());
+
+    options.offset = 50;
+    options.length = 51;
+    const mapped_file too_long{file.path(), options, ec};
+    EXPECT_TRUE(ec == std::errc::invalid_argument && too_long.empty());
+
+    options.length = 50;
+    const mapped_file exact{file.path(), options, ec};
+    EXPECT_TRUE(!ec && exact.size() == 50);
+
+    EXPECT_THROW(mapped_file{"/nonexistent/gsl_mapped_file"}, std::system_error);
+}
+
+TEST(mapped_file_tests, writes)
+{
+    const std::size_t size = 2 * page_size() + 5;
+    const temp_file file{pattern(size)};
+
+    map_options options;
+    options.mode = map_mode::read_write;
+    options.offset = page_size() + 1;
+    {
+        mapped_file shared{file.path(), options};
+        EXPECT_TRUE(shared.writable());
+        const span<gsl::impl::byte> bytes = shared.writable_bytes();
+        bytes[0] = static_cast<gsl::impl::byte>(0xAA);
+        bytes[bytes.size() - 1] = static_cast<gsl::impl::byte>(0xBB);
+        shared.sync(bytes.first(1));
+        shared.sync();
+    }
+    EXPECT_TRUE(file.at(page_size() + 1) == 0xAA && file.at(size - 1) == 0xBB);
+    EXPECT_TRUE(file.at(page_size()) == page_size() % 251);
+
+    options.mode = map_mode::copy_on_write;
+    {
+        mapped_file copy{file.path(), options};
+        EXPECT_TRUE(copy.writable());
+        copy.writable_bytes()[0] = static_cast<gsl::impl::byte>(0xCC);
+        EXPECT_TRUE(static_cast<unsigned char>(copy.bytes()[0]) == 0xCC);
+    }
+    EXPECT_TRUE(file.at(page_size() + 1) == 0xAA);
+}
+
+TEST(mapped_file_tests, hints)
+{
+    const std::size_t size = 8 * page_size();
+    const temp_file file{pattern(size)};
+
+    map_options options;
+    options.populate = true;
+    options.huge_pages = true;
+    options.advice = map_advice::sequential;
+    mapped_file mapped{file.path(), options};
+    EXPECT_TRUE(matches_pattern(mapped.bytes(), 0));
+
+    std::error_code ec;
+    mapped.advise(map_advice::random, ec);
+    EXPECT_FALSE(ec);
+    mapped.advise(map_advice::will_need, mapped.bytes().subspan(page_size() + 7, 10), ec);
+    EXPECT_FALSE(ec);
+    mapped.advise(map_advice::dont_need, mapped.bytes().last(page_size() / 2));
+    mapped.advise(map_advice::normal, mapped.bytes().first(0));
+    EXPECT_TRUE(matches_pattern(mapped.bytes(), 0));
+}
+
+TEST(mapped_file_tests, move)
+{
+    const temp_file file{pattern(100)};
+
+    mapped_file first{file.path()};
+    const gsl::impl::byte* const data = first.bytes().data();
+
+    mapped_file second{std::move(first)};
+    EXPECT_TRUE(first.empty() && first.bytes().empty() && first.file_size() == 0);
+    EXPECT_TRUE(second.size() == 100 && second.bytes().data() == data);
+
+    mapped_file third;
+    EXPECT_TRUE(third.empty());
+    third = std::move(second);
+    EXPECT_TRUE(second.empty() && third.bytes().data() == data);
+
+    swap(first, third);
+    EXPECT_TRUE(third.empty() && first.bytes().data() == data);
+    EXPECT_TRUE(matches_pattern(first.bytes(), 0));
+}
+
+TEST(mapped_file_tests, misuse_is_checked)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. misuse_is_checked";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    const temp_file file{pattern(100)};
+    mapped_file mapped{file.path()};
+    const unsigned char other[4] = {};
+
+    EXPECT_DEATH(mapped.writable_bytes(), expected);
+    EXPECT_DEATH(mapped.sync(as_bytes(span<const unsigned char>{other})), expected);
+
+    map_options options;
+    options.offset = 10;
+    mapped_file window{file.path(), options};
+    EXPECT_DEATH(window.advise(map_advice::random, mapped.bytes()), expected);
+    EXPECT_DEATH(window.advise(map_advice::random,
+                               span<const gsl::impl::byte>{window.bytes().data(), 91}),
+                 expected);
+}
+
+#endif // defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
@@ -0,0 +1,218 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/mdspan> // for mdspan, extents, dextents, layout_*
+#include <gsl/span>   // for span
+
+#include <array>       // for array
+#include <cstddef>     // for size_t
+#include <limits>      // for numeric_limits
+#include <type_traits> // for integral_constant, is_same
+#include <vector>      // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+template <std::size_t I>
+using index_constant = std::integral_constant<std::size_t, I>;
+
+std::vector<int> iota(std::size_t count)
+{
+    std::vector<int> v(count);
+    for (std::size_t i = 0; i < count; ++i) v[i] = static_cast<int>(i);
+    return v;
+}
+} // namespace
+
+static_assert(sizeof(extents<2, 3>) == 1, "static extents have no storage");
+static_assert(sizeof(dextents<2>) == 2 * sizeof(std::size_t),
+              "dynamic extents store one size each");
+static_assert(sizeof(layout_right::mapping<extents<2, 3>>) == sizeof(std::size_t),
+              "a mapping over static extents only stores its required size");
+static_assert(extents<2, dynamic_extent, 4>::rank() == 3, "rank");
+static_assert(extents<2, dynamic_extent, 4>::rank_dynamic() == 1, "rank_dynamic");
+static_assert(std::is_same<dextents<2>, extents<dynamic_extent, dynamic_extent>>::value,
+              "dextents");
+
+TEST(mdspan_tests, extents)
+{
+    constexpr extents<2, 3> static_ext;
+    static_assert(static_ext.extent(0) == 2 && static_ext.extent(1) == 3, "static extents");
+
+    const extents<2, dynamic_extent, 4> mixed(3);
+    EXPECT_TRUE(mixed.extent(0) == 2);
+    EXPECT_TRUE(mixed.extent(1) == 3);
+    EXPECT_TRUE(mixed.extent(2) == 4);
+
+    const extents<2, dynamic_extent, 4> all(2, 3, 4);
+    EXPECT_TRUE(all == mixed);
+    EXPECT_TRUE(dextents<3>(mixed) == mixed);
+    EXPECT_TRUE(dextents<3>(2, 3, 5) != mixed);
+
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. extents";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    EXPECT_DEATH((extents<2, dynamic_extent>(3, 3)), expected);
+    EXPECT_DEATH((extents<2, 3>(dextents<2>(2, 4))), expected);
+
+    // the number of elements must fit into size_t, unless an extent is zero
+    constexpr std::size_t huge = std::size_t{1} << (std::numeric_limits<std::size_t>::digits - 2);
+    EXPECT_DEATH((dextents<2>(huge, 4)), expected);
+    EXPECT_DEATH((extents<dynamic_extent, 8>(huge)), expected);
+    EXPECT_DEATH((extents<dynamic_extent, 8>(dextents<2>(huge, 8))), expected);
+    EXPECT_TRUE((dextents<3>(huge, 0, huge).extent(1) == 0));
+    EXPECT_TRUE((dextents<2>(huge, 3).extent(0) == huge));
+}
+
+TEST(mdspan_tests, layout_right)
+{
+    auto v = iota(24);
+    const mdspan<int, dextents<3>> m(v, 2, 3, 4);
+
+    EXPECT_TRUE(m.rank() == 3);
+    EXPECT_TRUE(m.size() == 24);
+    EXPECT_TRUE(m.stride(0) == 12 && m.stride(1) == 4 && m.stride(2) == 1);
+    EXPECT_TRUE(m(0, 0, 0) == 0);
+    EXPECT_TRUE(m(1, 2, 3) == 23);
+    EXPECT_TRUE(m(1, 0, 2) == 14);
+    EXPECT_TRUE(m.storage().size() == 24);
+
+    m(1, 1, 1) = -1;
+    EXPECT_TRUE(v[17] == -1);
+}
+
+TEST(mdspan_tests, layout_left)
+{
+    auto v = iota(6);
+    const mdspan<int, extents<2, 3>, layout_left> m(v);
+
+    EXPECT_TRUE(m.stride(0) == 1 && m.stride(1) == 2);
+    EXPECT_TRUE(m(1, 0) == 1);
+    EXPECT_TRUE(m(0, 2) == 4);
+    EXPECT_TRUE(m(1, 2) == 5);
+}
+
+TEST(mdspan_tests, padded_layouts)
+{
+    // a 3x4 image whose rows are 6 elements apart
+    auto v = iota(18);
+    const mdspan<int, dextents<2>, layout_right_padded> image(
+        v, layout_right_padded::mapping<dextents<2>>(dextents<2>(3, 4), 6));
+
+    EXPECT_TRUE(image.stride(0) == 6 && image.stride(1) == 1);
+    EXPECT_TRUE(image(1, 0) == 6);
+    EXPECT_TRUE(image(2, 3) == 15);
+    EXPECT_TRUE(image.mapping().required_span_size() == 16);
+    EXPECT_TRUE(image.size() == 12);
+
+    const mdspan<int, extents<4, dynamic_extent>, layout_left_padded> columns(
+        v, {extents<4, dynamic_extent>(3), 5});
+    EXPECT_TRUE(columns.stride(0) == 1 && columns.stride(1) == 5);
+    EXPECT_TRUE(columns(3, 2) == 13);
+
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. padded_layouts";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    // the pitch is smaller than a row
+    EXPECT_DEATH((layout_right_padded::mapping<dextents<2>>(dextents<2>(3, 4), 3)), expected);
+    // the last row does not fit
+    EXPECT_DEATH((mdspan<int, dextents<2>, layout_right_padded>(
+                     span<int>(v).first(15),
+                     layout_right_padded::mapping<dextents<2>>(dextents<2>(3, 4), 6))),
+                 expected);
+}
+
+TEST(mdspan_tests, static_indices)
+{
+    std::array<int, 6> a{{0, 1, 2, 3, 4, 5}};
+    const mdspan<int, extents<2, 3>> m(a);
+
+    EXPECT_TRUE(m(index_constant<1>{}, index_constant<2>{}) == 5);
+    EXPECT_TRUE(m(index_constant<1>{}, 0) == 3);
+}
+
+TEST(mdspan_tests, const_conversion)
+{
+    auto v = iota(6);
+    const mdspan<int, dextents<2>> m(v, 2, 3);
+    const mdspan<const int, dextents<2>> cm = m;
+
+    EXPECT_TRUE(cm(1, 1) == 4);
+    EXPECT_TRUE(cm.data_handle() == v.data());
+    EXPECT_TRUE(cm.extents() == m.extents());
+}
+
+TEST(mdspan_tests, empty_and_default)
+{
+    const mdspan<int, dextents<2>> m;
+    EXPECT_TRUE(m.empty());
+    EXPECT_TRUE(m.data_handle() == nullptr);
+    EXPECT_TRUE(m.mapping().required_span_size() == 0);
+
+    std::vector<int> v;
+    const mdspan<int, dextents<2>> none(v, 0, 5);
+    EXPECT_TRUE(none.empty());
+    EXPECT_TRUE(none.storage().empty());
+}
+
+TEST(mdspan_tests, bounds_checks)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. bounds_checks";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    auto v = iota(12);
+    const mdspan<int, dextents<2>> m(v, 3, 4);
+
+    EXPECT_DEATH(m(3, 0), expected);
+    EXPECT_DEATH(m(0, 4), expected);
+    EXPECT_DEATH(m(-1, 0), expected);
+    // the storage is too small
+    EXPECT_DEATH((mdspan<int, dextents<2>>(v, 4, 4)), expected);
+    // the size overflows
+    EXPECT_DEATH((mdspan<int, dextents<2>>(v, std::size_t{1} << 40, std::size_t{1} << 40)),
+                 expected);
+}
+
+#if (defined(__cpp_deduction_guides) && (__cpp_deduction_guides >= 201611L))
+TEST(mdspan_tests, deduction_guides)
+{
+    auto v = iota(6);
+    const mdspan m(span<int>(v), 2, 3);
+    static_assert(std::is_same<decltype(m), const mdspan<int, dextents<2>>>::value,
+                  "deduced from sizes");
+
+    const mdspan padded(span<int>(v),
+                        layout_right_padded::mapping<extents<2, 2>>(extents<2, 2>(), 3));
+    static_assert(std::is_same<decltype(padded),
+                               const mdspan<int, extents<2, 2>, layout_right_padded>>::value,
+                  "deduced from a mapping");
+    EXPECT_TRUE(padded(1, 1) == 4);
+}
+#endif // (defined(__cpp_deduction_guides) && (__cpp_deduction_guides >= 201611L))
@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/non_empty_span> // for non_empty_span, make_non_empty_span
+#include <gsl/span>           // for span
+
+#include <array>       // for array
+#include <type_traits> // for is_same, is_convertible, is_default_constructible
+#include <vector>      // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+static_assert(!std::is_default_constructible<non_empty_span<int>>::value,
+              "a non_empty_span cannot be default constructed");
+static_assert(std::is_convertible<span<int>, non_empty_span<int>>::value,
+              "a span converts to a non_empty_span, like a pointer to not_null");
+static_assert(std::is_convertible<non_empty_span<int, 3>, non_empty_span<const int>>::value,
+              "non_empty_spans convert like the spans they hold");
+static_assert(std::is_convertible<non_empty_span<int>, span<int>>::value,
+              "a non_empty_span converts to a span");
+static_assert(sizeof(non_empty_span<int, 4>) == sizeof(int*),
+              "a non_empty_span of static extent must be a single pointer");
+
+TEST(non_empty_span_tests, construction)
+{
+    int arr[4] = {1, 2, 3, 4};
+    std::vector<int> v{5, 6};
+
+    const non_empty_span<int> a = span<int>{arr};
+    EXPECT_TRUE(a.size() == 4 && a.data() == arr);
+    EXPECT_FALSE(a.empty());
+
+    const non_empty_span<int, 4> fixed{arr};
+    EXPECT_TRUE(fixed.size() == 4);
+
+    const non_empty_span<const int> from_vector{v};
+    EXPECT_TRUE(from_vector.size() == 2 && from_vector.size_bytes() == 2 * sizeof(int));
+
+    const non_empty_span<const int> converted = fixed;
+    EXPECT_TRUE(converted.data() == arr && converted.size() == 4);
+
+    const auto made = make_non_empty_span(span<int, 4>{arr});
+    static_assert(std::is_same<decltype(made), const non_empty_span<int, 4>>::value,
+                  "make_non_empty_span must keep the extent");
+
+    const span<int> back_to_span = a;
+    EXPECT_TRUE(back_to_span.size() == 4 && a.get().data() == arr);
+}
+
+TEST(non_empty_span_tests, element_access)
+{
+    int arr[4] = {1, 2, 3, 4};
+    const non_empty_span<int> a = span<int>{arr};
+
+    EXPECT_TRUE(a.front() == 1 && a.back() == 4 && a[2] == 3);
+
+    int sum = 0;
+    for (int x : a) sum += x;
+    EXPECT_TRUE(sum == 10);
+    EXPECT_TRUE(*a.rbegin() == 4 && a.rend() - a.rbegin() == 4);
+
+    const non_empty_span<int> single = span<int>{arr, 1};
+    EXPECT_TRUE(&single.front() == &single.back());
+}
+
+TEST(non_empty_span_tests, views)
+{
+    int arr[6] = {1, 2, 3, 4, 5, 6};
+    const non_empty_span<int> a = span<int>{arr};
+
+    const auto head = a.first<1>();
+    static_assert(std::is_same<decltype(head), const non_empty_span<int, 1>>::value,
+                  "first<N>() must stay non-empty");
+    EXPECT_TRUE(head.front() == 1);
+
+    const auto tail = a.last<2>();
+    static_assert(std::is_same<decltype(tail), const non_empty_span<int, 2>>::value,
+                  "last<N>() must stay non-empty");
+    EXPECT_TRUE(tail.front() == 5 && tail.back() == 6);
+
+    const auto middle = a.subspan<1, 3>();
+    static_assert(std::is_same<decltype(middle), const non_empty_span<int, 3>>::value,
+                  "subspan<Offset, Count>() must stay non-empty");
+    EXPECT_TRUE(middle.front() == 2 && middle.back() == 4);
+
+    const auto rest = a.subspan<1>();
+    static_assert(std::is_same<decltype(rest), const span<int>>::value,
+                  "subspan<Offset>() of a dynamic span may be empty");
+    EXPECT_TRUE(rest.size() == 5);
+
+    const non_empty_span<int, 6> fixed{arr};
+    const auto fixed_rest = fixed.subspan<2>();
+    static_assert(std::is_same<decltype(fixed_rest), const non_empty_span<int, 4>>::value,
+                  "subspan<Offset>() of a static span is non-empty if it has elements left");
+    static_assert(std::is_same<decltype(fixed.subspan<6>()), span<int, 0>>::value,
+                  "subspan<Offset>() of a static span is empty if it has no elements left");
+
+    EXPECT_TRUE(a.first(0).empty() && a.last(2).size() == 2 && a.subspan(5).size() == 1);
+}
+
+TEST(non_empty_span_tests, emptiness_is_checked)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. emptiness_is_checked";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    int arr[2] = {1, 2};
+    std::vector<int> v;
+
+    EXPECT_DEATH((non_empty_span<int>{span<int>{}}), expected);
+    EXPECT_DEATH((non_empty_span<int>{v}), expected);
+    EXPECT_DEATH(make_non_empty_span(span<int>{arr}.first(0)), expected);
+
+    const non_empty_span<int> a = span<int>{arr};
+    EXPECT_DEATH(a[2], expected);
+    EXPECT_DEATH(a.first<3>(), expected);
+    EXPECT_DEATH((a.subspan<1, 2>()), expected);
+}
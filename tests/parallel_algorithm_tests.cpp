@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/parallel_algorithm> // for copy
+#include <gsl/span>               // for span
+
+#include <algorithm> // for equal
+#include <array>     // for array
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uintptr_t
+#include <vector>    // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+TEST(parallel_algorithm_tests, copy)
+{
+    // enough data for four threads, with a destination that is not cache line aligned
+    const std::size_t count = 4 * GSL_PARALLEL_COPY_MIN_BYTES / sizeof(int) + 11;
+    std::vector<int> src(count);
+    for (std::size_t i = 0; i < count; ++i) src[i] = static_cast<int>(i);
+    std::vector<int> dst(count + 2, -1);
+
+    copy(span<const int>(src), span<int>(dst).subspan(1), 4);
+    EXPECT_TRUE(dst[0] == -1 && dst[count + 1] == -1);
+    EXPECT_TRUE(std::equal(src.begin(), src.end(), dst.begin() + 1));
+
+    // more threads than there is data for
+    std::vector<short> small_src(1000, 7);
+    std::vector<long long> small_dst(1000);
+    copy(span<const short>(small_src), span<long long>(small_dst), 64);
+    EXPECT_TRUE(std::equal(small_src.begin(), small_src.end(), small_dst.begin()));
+
+    // hardware concurrency
+    std::vector<int> dst2(count);
+    copy(span<const int>(src), span<int>(dst2), 0);
+    EXPECT_TRUE(dst2 == src);
+}
+
+TEST(parallel_algorithm_tests, cache_line_boundaries)
+{
+    // 12 byte elements, whose size does not divide a cache line
+    struct triple
+    {
+        int values[3];
+    };
+    constexpr std::size_t step = details::elements_per_cache_line_multiple<triple>();
+    EXPECT_TRUE(step == 16);
+
+    for (std::uintptr_t dest = 0; dest < 64; dest += alignof(triple))
+    {
+        const std::size_t head = details::first_cache_line_element(dest, sizeof(triple));
+        EXPECT_TRUE(head < step);
+        for (std::size_t i = 0; i < 4; ++i)
+            EXPECT_TRUE((dest + (head + i * step) * sizeof(triple)) % 64 == 0);
+    }
+
+    // no element of an 8 byte type can start on a cache line when dest is only 4 byte aligned
+    EXPECT_TRUE(details::first_cache_line_element(4, 8) == 0);
+    EXPECT_TRUE(details::first_cache_line_element(8, 8) == 7);
+
+    const std::size_t count = 3 * GSL_PARALLEL_COPY_MIN_BYTES / sizeof(triple) + 5;
+    std::vector<triple> src(count);
+    for (std::size_t i = 0; i < count; ++i) src[i] = {{static_cast<int>(i), 1, 2}};
+    std::vector<triple> dst(count + 1);
+    copy(span<const triple>(src), span<triple>(dst).subspan(1), 3);
+    EXPECT_TRUE(std::equal(src.begin(), src.end(), dst.begin() + 1,
+                           [](const triple& a, const triple& b) {
+                               return a.values[0] == b.values[0] && a.values[1] == b.values[1] &&
+                                      a.values[2] == b.values[2];
+                           }));
+}
+
+TEST(parallel_algorithm_tests, copy_preconditions)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. copy_preconditions";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    std::array<int, 12> a{};
+    const span<int> s{a};
+
+    EXPECT_DEATH(copy(s, s.first(4), 2), expected);
+    EXPECT_DEATH(copy(s.first(8), s.subspan(4), 2), expected);
+    EXPECT_DEATH(copy(s.subspan(4), s.first(8), 2), expected);
+}
@@ -0,0 +1,231 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/soa>  // for soa_span, soa_vector, interleave, deinterleave
+#include <gsl/span> // for span
+
+#include <iostream>    // for cerr
+#include <stdexcept>   // for runtime_error
+#include <string>      // for string
+#include <tuple>       // for get, make_tuple
+#include <type_traits> // for is_same, is_convertible
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+struct particle
+{
+    long x;
+    long y;
+    int id;
+};
+
+// a field whose copy assignment may throw, and does for the value -1
+struct fragile
+{
+    fragile() = default;
+    fragile(const fragile&) = default;
+    fragile(fragile&&) noexcept = default;
+    fragile& operator=(fragile&&) noexcept = default;
+    fragile& operator=(const fragile& other)
+    {
+        if (other.value == -1) throw std::runtime_error("fragile");
+        value = other.value;
+        return *this;
+    }
+
+    int value = 0;
+};
+
+struct named
+{
+    std::string name;
+    fragile f;
+};
+} // namespace
+
+static_assert(std::is_convertible<soa_span<long, int>, soa_span<const long, const int>>::value,
+              "a soa_span converts to a soa_span of const fields");
+static_assert(!std::is_convertible<soa_span<const long, int>, soa_span<long, int>>::value,
+              "a soa_span of const fields does not convert to one of mutable fields");
+static_assert(std::is_convertible<soa_vector<long, int>&, soa_span<long, int>>::value,
+              "a soa_vector converts to a soa_span");
+
+TEST(soa_tests, soa_span)
+{
+    long x[3] = {1, 2, 3};
+    int id[3] = {7, 8, 9};
+
+    const soa_span<long, int> s{span<long>{x}, span<int>{id}};
+    EXPECT_TRUE(s.size() == 3);
+    EXPECT_FALSE(s.empty());
+    EXPECT_TRUE(s.column<0>().data() == x && s.column<1>().data() == id);
+    static_assert(std::is_same<decltype(s.column<1>()), span<int>>::value,
+                  "column<I>() is the span of the I-th field");
+
+    std::get<1>(s[1]) = 80;
+    EXPECT_TRUE(id[1] == 80 && std::get<0>(s[2]) == 3);
+
+    int sum = 0;
+    for (auto&& row : s) sum += std::get<1>(row);
+    EXPECT_TRUE(sum == 7 + 80 + 9);
+
+    const soa_span<const long, const int> c = s;
+    EXPECT_TRUE(c.size() == 3 && &std::get<0>(c[0]) == &x[0]);
+
+    const auto tail = s.subspan(1);
+    EXPECT_TRUE(tail.size() == 2 && tail.column<0>().data() == x + 1);
+    EXPECT_TRUE(s.first(2).size() == 2 && s.first(2).column<1>().data() == id);
+    EXPECT_TRUE(s.last(1).size() == 1 && s.last(1).column<1>().data() == id + 2);
+    EXPECT_TRUE(s.rows().size() == 3);
+
+    const soa_span<long, int> empty;
+    EXPECT_TRUE(empty.empty() && empty.begin() == empty.end());
+
+#if (defined(__cpp_deduction_guides) && (__cpp_deduction_guides >= 201611L))
+    const soa_span deduced{span<long, 3>{x}, span<int>{id}};
+    static_assert(std::is_same<decltype(deduced), const soa_span<long, int>>::value,
+                  "the deduction guide must drop the extents");
+    EXPECT_TRUE(deduced.size() == 3);
+#endif
+}
+
+TEST(soa_tests, soa_vector)
+{
+    soa_vector<long, int, std::string> v;
+    EXPECT_TRUE(v.empty() && v.size() == 0);
+
+    v.push_back(15, 1, "one");
+    v.push_back(25, 2, "two");
+    v.push_back(35, 3, "three");
+    EXPECT_TRUE(v.size() == 3 && v.capacity() >= 3);
+    EXPECT_TRUE(v.column<0>().size() == 3 && v.column<2>()[1] == "two");
+
+    std::get<1>(v[0]) = 10;
+    v[2] = std::make_tuple(45, 4, std::string{"four"});
+    EXPECT_TRUE(v.column<1>()[0] == 10 && std::get<2>(v[2]) == "four");
+
+    const auto& cv = v;
+    static_assert(std::is_same<decltype(cv.column<0>()), span<const long>>::value,
+                  "the columns of a const soa_vector are const");
+    EXPECT_TRUE(std::get<0>(cv[1]) == 25);
+
+    long total = 0;
+    for (auto&& row : cv) total += std::get<0>(row);
+    EXPECT_TRUE(total == 15 + 25 + 45);
+
+    const soa_span<long, int, std::string> view = v;
+    EXPECT_TRUE(view.size() == 3 && view.column<1>().data() == v.column<1>().data());
+
+    v.pop_back();
+    EXPECT_TRUE(v.size() == 2 && v.column<2>().size() == 2);
+
+    v.resize(5);
+    EXPECT_TRUE(v.size() == 5 && std::get<1>(v[4]) == 0 && std::get<2>(v[4]).empty());
+
+    v.reserve(100);
+    EXPECT_TRUE(v.capacity() >= 100 && v.size() == 5);
+
+    v.clear();
+    EXPECT_TRUE(v.empty() && v.column<0>().empty());
+
+    const soa_vector<double, char> sized(4);
+    EXPECT_TRUE(sized.size() == 4 && sized.column<1>().size() == 4);
+}
+
+TEST(soa_tests, interleave)
+{
+    const particle aos[3] = {{1, 2, 1}, {3, 4, 2}, {5, 6, 3}};
+
+    soa_vector<long, long, int> v(3);
+    deinterleave(span<const particle>{aos}, v.view(), &particle::x, &particle::y, &particle::id);
+    EXPECT_TRUE(v.column<0>()[2] == 5 && v.column<1>()[0] == 2 && v.column<2>()[1] == 2);
+
+    // only the columns that are needed
+    long ys[3] = {};
+    deinterleave(span<const particle>{aos}, soa_span<long>{span<long>{ys}}, &particle::y);
+    EXPECT_TRUE(ys[0] == 2 && ys[1] == 4 && ys[2] == 6);
+
+    std::get<2>(v[0]) = 42;
+    particle back[3] = {};
+    interleave(v.view(), span<particle>{back}, &particle::x, &particle::y, &particle::id);
+    EXPECT_TRUE(back[0].id == 42 && back[1].x == 3 && back[2].y == 6);
+
+    const auto& cv = v;
+    particle ids[3] = {};
+    interleave(soa_span<const int>{cv.column<2>()}, span<particle>{ids}, &particle::id);
+    EXPECT_TRUE(ids[0].id == 42 && ids[2].id == 3 && ids[1].x == 0);
+}
+
+TEST(soa_tests, interleave_may_throw)
+{
+    // noexcept only when every assignment is, a throwing one reaches the caller
+    long xs[1] = {};
+    static_assert(noexcept(deinterleave(span<const particle>{}, soa_span<long>{span<long>{xs}},
+                                        &particle::x)),
+                  "copying trivial members is noexcept");
+
+    named aos[2] = {{"a", {}}, {"b", {}}};
+    aos[1].f.value = -1;
+    soa_vector<std::string, fragile> v(2);
+    static_assert(!noexcept(deinterleave(span<named>{aos}, v.view(), &named::name, &named::f)),
+                  "copying a member that may throw is not noexcept");
+    static_assert(!noexcept(interleave(v.view(), span<named>{aos}, &named::name, &named::f)),
+                  "copying a member that may throw is not noexcept");
+
+    EXPECT_THROW(deinterleave(span<named>{aos}, v.view(), &named::name, &named::f),
+                 std::runtime_error);
+    EXPECT_TRUE(std::get<0>(v[1]) == "b" && std::get<1>(v[0]).value == 0);
+
+    std::get<1>(v[1]).value = 7;
+    aos[1].f.value = 0;
+    interleave(v.view(), span<named>{aos}, &named::name, &named::f);
+    EXPECT_TRUE(aos[0].name == "a" && aos[1].f.value == 7);
+}
+
+TEST(soa_tests, bounds_are_checked)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. bounds_are_checked";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    long x[3] = {1, 2, 3};
+    int id[2] = {7, 8};
+
+    EXPECT_DEATH((soa_span<long, int>{span<long>{x}, span<int>{id}}), expected);
+
+    const soa_span<long, int> s{span<long>{x}.first(2), span<int>{id}};
+    EXPECT_DEATH(s[2], expected);
+    EXPECT_DEATH(s.subspan(3), expected);
+    EXPECT_DEATH(s.last(3), expected);
+
+    soa_vector<long, int> v;
+    EXPECT_DEATH(v.pop_back(), expected);
+    EXPECT_DEATH(v[0], expected);
+
+    const particle aos[3] = {};
+    EXPECT_DEATH(deinterleave(span<const particle>{aos}, s, &particle::x, &particle::id),
+                 expected);
+    particle out[3] = {};
+    EXPECT_DEATH(interleave(s, span<particle>{out}, &particle::x, &particle::id), expected);
+}
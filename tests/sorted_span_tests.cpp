@@ -0,0 +1,167 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/sorted_span> // for sorted_span, make_sorted_span, eytzinger_layout
+#include <gsl/span>        // for span
+
+#include <algorithm>  // for lower_bound, upper_bound, sort
+#include <cstddef>    // for size_t
+#include <functional> // for greater
+#include <vector>     // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+struct record
+{
+    int key;
+    int payload;
+};
+
+struct by_key
+{
+    bool operator()(const record& l, const record& r) const { return l.key < r.key; }
+    bool operator()(const record& l, int r) const { return l.key < r; }
+    bool operator()(int l, const record& r) const { return l < r.key; }
+};
+
+// 0, 0, 2, 2, 4, 4, ... so that every key has a duplicate and odd keys are missing
+std::vector<int> pairs(std::size_t count)
+{
+    std::vector<int> v;
+    for (std::size_t i = 0; i < count; ++i) v.push_back(static_cast<int>(i / 2 * 2));
+    return v;
+}
+} // namespace
+
+TEST(sorted_span_tests, bounds_match_std)
+{
+    for (std::size_t count = 0; count < 40; ++count)
+    {
+        const std::vector<int> v = pairs(count);
+        const sorted_span<const int> s{span<const int>{v}};
+
+        for (int key = -1; key <= static_cast<int>(count) + 1; ++key)
+        {
+            const auto lower = std::lower_bound(v.begin(), v.end(), key) - v.begin();
+            const auto upper = std::upper_bound(v.begin(), v.end(), key) - v.begin();
+            EXPECT_TRUE(s.lower_bound(key) == static_cast<std::size_t>(lower));
+            EXPECT_TRUE(s.upper_bound(key) == static_cast<std::size_t>(upper));
+
+            const auto range = s.equal_range(key);
+            EXPECT_TRUE(range.size() == static_cast<std::size_t>(upper - lower));
+            EXPECT_TRUE(range.empty() || range.data() == v.data() + lower);
+            EXPECT_TRUE(s.contains(key) == (upper != lower));
+        }
+    }
+}
+
+TEST(sorted_span_tests, views_and_comparators)
+{
+    int arr[] = {9, 7, 7, 3, 1};
+    const auto s = make_sorted_span(span<int>{arr}, std::greater<>{});
+    EXPECT_TRUE(s.size() == 5 && s.front() == 9 && s.back() == 1 && s[1] == 7);
+    EXPECT_TRUE(s.lower_bound(7) == 1 && s.upper_bound(7) == 3);
+    EXPECT_TRUE(s.lower_bound(10) == 0 && s.lower_bound(0) == 5);
+
+    const auto tail = s.subspan(2);
+    EXPECT_TRUE(tail.size() == 3 && tail.lower_bound(3) == 1);
+    EXPECT_TRUE(s.first(2).upper_bound(7) == 2 && s.last(1).contains(1));
+
+    const sorted_span<const int, std::greater<>> as_const = s;
+    EXPECT_TRUE(as_const.data() == arr);
+    const span<int> plain = s;
+    EXPECT_TRUE(plain.size() == 5);
+
+    int sum = 0;
+    for (int x : s) sum += x;
+    EXPECT_TRUE(sum == 27);
+
+    const record records[] = {{1, 10}, {3, 30}, {3, 31}, {8, 80}};
+    const sorted_span<const record, by_key> r{span<const record>{records}};
+    EXPECT_TRUE(r.equal_range(3).size() == 2 && r.equal_range(3).front().payload == 30);
+    EXPECT_TRUE(r.lower_bound(4) == 3 && !r.contains(4));
+
+    const sorted_span<int> empty;
+    EXPECT_TRUE(empty.empty() && empty.lower_bound(0) == 0 && empty.upper_bound(0) == 0);
+    EXPECT_FALSE(empty.contains(0));
+}
+
+TEST(sorted_span_tests, eytzinger_layout)
+{
+    for (std::size_t count = 0; count < 70; ++count)
+    {
+        const std::vector<int> v = pairs(count);
+        const eytzinger_layout<const int> e{sorted_span<const int>{span<const int>{v}}};
+        EXPECT_TRUE(e.size() == count && e.empty() == (count == 0));
+
+        for (int key = -1; key <= static_cast<int>(count) + 1; ++key)
+        {
+            const auto lower = std::lower_bound(v.begin(), v.end(), key);
+            const auto upper = std::upper_bound(v.begin(), v.end(), key);
+
+            const int* found_lower = e.lower_bound(key);
+            const int* found_upper = e.upper_bound(key);
+            EXPECT_TRUE(lower == v.end() ? found_lower == nullptr
+                                         : found_lower != nullptr && *found_lower == *lower);
+            EXPECT_TRUE(upper == v.end() ? found_upper == nullptr
+                                         : found_upper != nullptr && *found_upper == *upper);
+
+            const int* found = e.find(key);
+            EXPECT_TRUE(lower == upper ? found == nullptr : found != nullptr && *found == key);
+        }
+    }
+
+    // the children of node k are 2k and 2k + 1
+    const int sorted[] = {1, 2, 3, 4, 5, 6, 7};
+    const eytzinger_layout<const int> e{sorted_span<const int>{span<const int>{sorted}}};
+    const std::vector<int> tree(e.tree().begin() + 1, e.tree().end());
+    EXPECT_TRUE((tree == std::vector<int>{4, 2, 6, 1, 3, 5, 7}));
+
+    const record records[] = {{1, 10}, {3, 30}, {8, 80}};
+    const eytzinger_layout<const record, by_key> r{
+        sorted_span<const record, by_key>{span<const record>{records}}};
+    const record* found = r.find(8);
+    ASSERT_TRUE(found != nullptr);
+    EXPECT_TRUE(found->payload == 80);
+    EXPECT_TRUE(r.find(2) == nullptr);
+    const record* lower = r.lower_bound(2);
+    ASSERT_TRUE(lower != nullptr);
+    EXPECT_TRUE(lower->payload == 30);
+    EXPECT_TRUE(r.lower_bound(9) == nullptr && r.upper_bound(8) == nullptr);
+}
+
+TEST(sorted_span_tests, bounds_checks)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. bounds_checks";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    const int arr[] = {1, 2, 3};
+    const sorted_span<const int> s{span<const int>{arr}};
+
+    EXPECT_DEATH(s[3], expected);
+    EXPECT_DEATH(s.first(4), expected);
+    EXPECT_DEATH(s.subspan(4), expected);
+    EXPECT_DEATH(sorted_span<const int>{}.front(), expected);
+}
@@ -0,0 +1,250 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/byte>        // for byte, to_integer
+#include <gsl/span>        // for span, as_bytes, as_writable_bytes
+#include <gsl/span_cursor> // for span_reader, span_writer
+
+#include <cstdint>  // for uint8_t, uint16_t, uint32_t, uint64_t, int32_t, int64_t
+#include <iostream> // for cerr
+#include <limits>   // for numeric_limits
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+// the encoded bytes, as unsigned chars
+template <std::size_t N>
+bool bytes_are(span<const gsl::impl::byte> bytes, const unsigned char (&expected)[N])
+{
+    if (bytes.size() != N) return false;
+    for (std::size_t i = 0; i < N; ++i)
+        if (static_cast<unsigned char>(bytes[i]) != expected[i]) return false;
+    return true;
+}
+
+span<const gsl::impl::byte> bytes_of(const unsigned char* data, std::size_t size)
+{
+    return as_bytes(span<const unsigned char>{data, size});
+}
+} // namespace
+
+TEST(span_cursor_tests, byte_order)
+{
+    unsigned char buffer[16] = {};
+    span_writer w{as_writable_bytes(span<unsigned char>{buffer})};
+    w.write_le(std::uint32_t{0x01020304});
+    w.write_be(std::uint32_t{0x01020304});
+    w.write_le(std::int16_t{-2});
+    w.write_be(std::uint16_t{0xABCD});
+    w.write_le(std::uint8_t{0x7F});
+    EXPECT_TRUE(w.position() == 13 && w.remaining() == 3 && !w.full());
+
+    const unsigned char expected[] = {4, 3, 2, 1, 1, 2, 3, 4, 0xFE, 0xFF, 0xAB, 0xCD, 0x7F};
+    EXPECT_TRUE(bytes_are(w.written(), expected));
+
+    span_reader r{w.written()};
+    EXPECT_TRUE(r.read_le<std::uint32_t>() == 0x01020304);
+    EXPECT_TRUE(r.read_be<std::uint32_t>() == 0x01020304);
+    EXPECT_TRUE(r.read_le<std::int16_t>() == -2);
+    EXPECT_TRUE(r.read_be<std::uint16_t>() == 0xABCD);
+    EXPECT_TRUE(r.read_le<std::uint8_t>() == 0x7F);
+    EXPECT_TRUE(r.empty() && r.position() == 13 && r.remaining() == 0);
+}
+
+TEST(span_cursor_tests, floating_point)
+{
+    unsigned char buffer[12] = {};
+    span_writer w{as_writable_bytes(span<unsigned char>{buffer})};
+    w.write_be(1.0f);
+    w.write_le(-2.5);
+
+    const unsigned char one_be[] = {0x3F, 0x80, 0, 0};
+    EXPECT_TRUE(bytes_are(w.written().first(4), one_be));
+
+    span_reader r{w.written()};
+    EXPECT_TRUE(r.read_be<float>() >= 1.0f && r.position() == 4);
+    const double d = r.read_le<double>();
+    EXPECT_TRUE(d <= -2.5 && d >= -2.5);
+}
+
+TEST(span_cursor_tests, varints)
+{
+    unsigned char buffer[64] = {};
+    span_writer w{as_writable_bytes(span<unsigned char>{buffer})};
+    w.write_varint(0U);
+    w.write_varint(127U);
+    w.write_varint(300U);
+    w.write_varint(std::numeric_limits<std::uint64_t>::max());
+    w.write_varint(-1);
+    w.write_varint(std::int64_t{-64});
+    w.write_varint(std::numeric_limits<std::int32_t>::min());
+
+    const unsigned char prefix[] = {0x00, 0x7F, 0xAC, 0x02};
+    EXPECT_TRUE(bytes_are(w.written().first(4), prefix));
+
+    span_reader r{w.written()};
+    EXPECT_TRUE(r.read_varint<unsigned>() == 0);
+    EXPECT_TRUE(r.read_varint<std::uint8_t>() == 127);
+    EXPECT_TRUE(r.read_varint<std::uint16_t>() == 300);
+    EXPECT_TRUE(r.read_varint() == std::numeric_limits<std::uint64_t>::max());
+    EXPECT_TRUE(r.position() == 14);
+    // zigzag: -1 is a single byte
+    EXPECT_TRUE(r.read_varint<int>() == -1 && r.position() == 15);
+    EXPECT_TRUE(r.read_varint<std::int64_t>() == -64);
+    EXPECT_TRUE(r.read_varint<std::int32_t>() == std::numeric_limits<std::int32_t>::min());
+    EXPECT_TRUE(r.empty());
+}
+
+TEST(span_cursor_tests, prefixed_and_raw_bytes)
+{
+    const unsigned char payload[] = {'a', 'b', 'c'};
+    unsigned char buffer[32] = {};
+    span_writer w{as_writable_bytes(span<unsigned char>{buffer})};
+    w.write_prefixed_le<std::uint16_t>(bytes_of(payload, 3));
+    w.write_prefixed_be<std::uint32_t>(bytes_of(payload, 2));
+    w.write_prefixed_varint(bytes_of(payload, 1));
+    w.write_bytes(bytes_of(payload, 3));
+
+    const unsigned char expected[] = {3, 0, 'a', 'b', 'c', 0, 0, 0, 2, 'a', 'b', 1, 'a',
+                                      'a', 'b', 'c'};
+    EXPECT_TRUE(bytes_are(w.written(), expected));
+
+    span_reader r{w.written()};
+    const unsigned char abc[] = {'a', 'b', 'c'};
+    const unsigned char ab[] = {'a', 'b'};
+    const unsigned char a[] = {'a'};
+    EXPECT_TRUE(bytes_are(r.read_prefixed_le<std::uint16_t>(), abc));
+    EXPECT_TRUE(bytes_are(r.read_prefixed_be<std::uint32_t>(), ab));
+    EXPECT_TRUE(bytes_are(r.read_prefixed_varint(), a));
+
+    const span<const gsl::impl::byte, 2> fixed = r.read_bytes<2>();
+    EXPECT_TRUE(bytes_are(fixed, ab));
+    const unsigned char c[] = {'c'};
+    EXPECT_TRUE(bytes_are(r.rest(), c));
+    r.skip(1);
+    EXPECT_TRUE(r.empty() && r.rest().empty());
+}
+
+TEST(span_cursor_tests, ensure)
+{
+    unsigned char buffer[16] = {};
+    span_writer w{as_writable_bytes(span<unsigned char>{buffer})};
+
+    const span<gsl::impl::byte> length = w.skip(2);
+    span_writer header = w.ensure(6);
+    EXPECT_TRUE(w.position() == 8 && header.remaining() == 6);
+    header.write_be(std::uint16_t{0x1234});
+    header.write_le(std::uint32_t{0xDEADBEEF});
+    EXPECT_TRUE(header.full());
+    w.write_le(std::uint8_t{9});
+    span_writer{length}.write_le(static_cast<std::uint16_t>(w.position()));
+
+    span_reader r{w.written()};
+    EXPECT_TRUE(r.read_le<std::uint16_t>() == 9);
+    span_reader fields = r.ensure(6);
+    EXPECT_TRUE(r.position() == 8 && fields.remaining() == 6);
+    EXPECT_TRUE(fields.read_be<std::uint16_t>() == 0x1234);
+    EXPECT_TRUE(fields.read_le<std::uint32_t>() == 0xDEADBEEF);
+    EXPECT_TRUE(fields.empty());
+    EXPECT_TRUE(r.read_le<std::uint8_t>() == 9 && r.empty());
+
+    const span_reader none;
+    EXPECT_TRUE(none.empty() && none.rest().empty());
+}
+
+TEST(span_cursor_tests, try_reads)
+{
+    const unsigned char data[] = {0xAC, 0x02, 0x03, 'a', 'b', 'c', 0x00, 0x09, 'x'};
+    span_reader r{bytes_of(data, 9)};
+
+    unsigned value = 0;
+    EXPECT_TRUE(r.try_read_varint(value) && value == 300 && r.position() == 2);
+    span<const gsl::impl::byte> bytes;
+    const unsigned char abc[] = {'a', 'b', 'c'};
+    EXPECT_TRUE(r.try_read_prefixed_varint(bytes) && bytes_are(bytes, abc));
+
+    // a count larger than what is left, and a count that is cut off
+    EXPECT_FALSE(r.try_read_prefixed_be<std::uint16_t>(bytes));
+    EXPECT_TRUE(r.position() == 6 && bytes_are(bytes, abc));
+    EXPECT_FALSE(r.try_read_prefixed_le<std::uint32_t>(bytes));
+    EXPECT_TRUE(r.position() == 6);
+    r.skip(1);
+    const unsigned char x[] = {'x'};
+    EXPECT_FALSE(r.try_read_prefixed_le<std::uint8_t>(bytes));
+    EXPECT_TRUE(r.try_read_varint(value) && value == 9 && bytes_are(r.rest(), x));
+
+    // truncated varints
+    int signed_value = 0;
+    const unsigned char truncated[] = {0x80, 0x80};
+    span_reader t{bytes_of(truncated, 2)};
+    EXPECT_FALSE(t.try_read_varint(signed_value));
+    EXPECT_FALSE(t.try_read_prefixed_varint(bytes));
+    EXPECT_FALSE(span_reader{}.try_read_varint(value));
+    EXPECT_TRUE(t.position() == 0 && signed_value == 0);
+
+    // overlong varints, for the type and for any type
+    const unsigned char too_big[] = {0x80, 0x02};
+    std::uint8_t small = 0;
+    EXPECT_FALSE(span_reader{bytes_of(too_big, 2)}.try_read_varint(small));
+    const unsigned char eleven[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                                    0xFF, 0xFF, 0xFF, 0x81, 0x00};
+    std::uint64_t large = 0;
+    EXPECT_FALSE(span_reader{bytes_of(eleven, 11)}.try_read_varint(large));
+    EXPECT_FALSE(span_reader{bytes_of(eleven, 10)}.try_read_varint(large));
+    const unsigned char largest[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+    EXPECT_TRUE(span_reader{bytes_of(largest, 10)}.try_read_varint(large));
+    EXPECT_TRUE(large == std::numeric_limits<std::uint64_t>::max());
+
+    // a count that does not fit into size_t is larger than what is left too
+    EXPECT_FALSE(span_reader{bytes_of(largest, 10)}.try_read_prefixed_varint(bytes));
+}
+
+TEST(span_cursor_tests, bounds_are_checked)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. bounds_are_checked";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    const unsigned char data[] = {1, 2, 3, 0x80, 0x80};
+
+    EXPECT_DEATH(span_reader{bytes_of(data, 3)}.read_le<std::uint32_t>(), expected);
+    EXPECT_DEATH(span_reader{bytes_of(data, 3)}.ensure(4), expected);
+    EXPECT_DEATH(span_reader{bytes_of(data, 3)}.ensure(2).read_be<std::uint32_t>(), expected);
+    EXPECT_DEATH(span_reader{bytes_of(data, 1)}.read_prefixed_le<std::uint8_t>(), expected);
+
+    // unterminated and overlong varints
+    EXPECT_DEATH(span_reader{bytes_of(data + 3, 2)}.read_varint(), expected);
+    const unsigned char too_big[] = {0x80, 0x02};
+    EXPECT_DEATH(span_reader{bytes_of(too_big, 2)}.read_varint<std::uint8_t>(), expected);
+
+    unsigned char buffer[4] = {};
+    span_writer w{as_writable_bytes(span<unsigned char>{buffer})};
+    EXPECT_DEATH(w.write_le(std::uint64_t{1}), expected);
+    EXPECT_DEATH(w.write_varint(std::numeric_limits<std::uint64_t>::max()), expected);
+    EXPECT_DEATH(w.write_prefixed_le<std::uint8_t>(bytes_of(data, 4)), expected);
+
+    unsigned char large[300] = {};
+    unsigned char out[400] = {};
+    span_writer big{as_writable_bytes(span<unsigned char>{out})};
+    EXPECT_DEATH(big.write_prefixed_le<std::uint8_t>(bytes_of(large, 300)), expected);
+}
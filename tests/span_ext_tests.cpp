@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include <gsl/byte> // for byte
 #include <gsl/span> // for span and span_ext
 #include <gsl/util> // for narrow_cast, at
 
@@ -377,4 +378,115 @@ TEST(span_ext_test, comparison_operators)
         EXPECT_FALSE(s1 >= s2);
     }
 }
+
+TEST(span_ext_test, comparison_operators_bytewise)
+{
+    // element types compared with memcmp
+    {
+        const unsigned char a[] = {1, 200, 3};
+        const unsigned char b[] = {1, 200, 4};
+        const unsigned char c[] = {1, 201};
+        const gsl::span<const unsigned char> sa = a;
+        const gsl::span<const unsigned char> sb = b;
+        const gsl::span<const unsigned char> sc = c;
+
+        EXPECT_TRUE(sa == sa.first(3));
+        EXPECT_FALSE(sa == sb);
+        EXPECT_TRUE(sa < sb);
+        EXPECT_TRUE(sb < sc); // 200 < 201 decides before the length does
+        EXPECT_TRUE(sa.first(2) < sa);
+        EXPECT_FALSE(sa < sa.first(2));
+        EXPECT_TRUE(sa >= sa.first(2));
+    }
+
+    {
+        const gsl::byte a[] = {gsl::to_byte<0x01>(), gsl::to_byte<0xF0>()};
+        const gsl::byte b[] = {gsl::to_byte<0x01>(), gsl::to_byte<0x0F>()};
+        const gsl::span<const gsl::byte> sa = a;
+        const gsl::span<const gsl::byte> sb = b;
+
+        EXPECT_TRUE(sa != sb);
+        EXPECT_TRUE(sb < sa);
+        EXPECT_TRUE(sa > sb);
+        EXPECT_TRUE(gsl::span<const gsl::byte>() < sb);
+    }
+
+    {
+        const int a[] = {-1, 0, 1};
+        const int b[] = {-1, 0, 1};
+        const int c[] = {-1, 0, 2};
+        EXPECT_TRUE(gsl::span<const int>(a) == gsl::span<const int>(b));
+        EXPECT_TRUE(gsl::span<const int>(a) != gsl::span<const int>(c));
+        // ints are not ordered like their bytes
+        EXPECT_TRUE(gsl::span<const int>(a).first(1) < gsl::span<const int>(a).last(1));
+    }
+
+    // element types that are not compared with memcmp
+    {
+        const double a[] = {0.0, 1.5};
+        const double b[] = {-0.0, 1.5};
+        EXPECT_TRUE(gsl::span<const double>(a) == gsl::span<const double>(b));
+
+        const signed char c[] = {-1};
+        const signed char d[] = {1};
+        EXPECT_TRUE(gsl::span<const signed char>(c) < gsl::span<const signed char>(d));
+    }
+}
 #endif // GSL_KERNEL_MODE
+
+TEST(span_ext_test, indices)
+{
+    int out[4] = {};
+    const int a[4] = {1, 2, 3, 4};
+    const std::array<int, 4> b = {10, 20, 30, 40};
+
+    const auto range = gsl::indices(gsl::span<int>{out}, gsl::span<const int>{a}, gsl::span<const int, 4>{b});
+    EXPECT_TRUE(range.size() == 4 && !range.empty());
+
+    for (const auto i : range)
+    {
+        gsl::span<int>{out}[i] = gsl::span<const int>{a}[i] + gsl::span<const int, 4>{b}[i];
+    }
+    EXPECT_TRUE(out[0] == 11 && out[3] == 44);
+
+    const gsl::span<int> s{out};
+    std::size_t count = 0;
+    for (const gsl::span_index i : s.indices())
+    {
+        EXPECT_TRUE(i.value() == count && i.bound() == 4);
+        const std::size_t as_size = i;
+        EXPECT_TRUE(as_size == count);
+        ++count;
+    }
+    EXPECT_TRUE(count == 4);
+
+    // a range over fewer elements may index a longer span
+    const auto shorter = s.first(2).indices();
+    EXPECT_TRUE(s[shorter[1]] == 22);
+
+    EXPECT_TRUE(gsl::span<int>{}.indices().empty());
+    EXPECT_TRUE(gsl::index_range{}.begin() == gsl::index_range{}.end());
+    EXPECT_TRUE(gsl::indices(gsl::span<int>{}).empty());
+}
+
+TEST(span_ext_test, indices_are_checked)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. indices_are_checked";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    int a[4] = {};
+    int b[3] = {};
+    const gsl::span<int> sa{a};
+    const gsl::span<int> sb{b};
+
+    EXPECT_DEATH(gsl::indices(sa, sb), expected);
+    EXPECT_DEATH(sb[sa.indices()[0]], expected);
+    EXPECT_DEATH(sa.indices()[4], expected);
+
+    auto it = sa.indices().end();
+    EXPECT_DEATH(*it, expected);
+    EXPECT_DEATH(++it, expected);
+}
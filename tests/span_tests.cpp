@@ -20,8 +20,10 @@
 #include <gsl/span> // for span, span_iterator, operator==, operator!=
 #include <gsl/util> // for narrow_cast, at
 
+#include <algorithm>   // for copy, equal, fill, lexicographical_compare
 #include <array>       // for array
 #include <cstddef>     // for ptrdiff_t
+#include <cstdint>     // for uint16_t, uint32_t, uint64_t
 #include <iostream>    // for ptrdiff_t
 #include <iterator>    // for reverse_iterator, operator-, operator==
 #include <memory>      // for unique_ptr, shared_ptr, make_unique, allo...
@@ -946,6 +948,12 @@ TEST(span_test, begin_end)
         it = s.end();
         it2 = std::end(s);
         EXPECT_TRUE(it == it2);
+
+        // begin and end are plain member functions
+        const auto begin = &span<int>::begin;
+        const auto rend = &span<int>::rend;
+        EXPECT_TRUE((s.*begin)() == s.begin());
+        EXPECT_TRUE((s.*rend)() == s.rend());
     }
 
     {
@@ -1101,6 +1109,75 @@ TEST(span_test, as_writable_bytes)
     }
 }
 
+template <typename T, typename U, typename = void>
+static constexpr bool AsWritableSpanCompilesFor = false;
+template <typename T, typename U>
+static constexpr bool
+    AsWritableSpanCompilesFor<T, U, void_t<decltype(as_writable_span<T>(std::declval<U>()))>> =
+        true;
+
+TEST(span_test, as_span)
+{
+    static_assert(AsWritableSpanCompilesFor<int, span<byte>>, "AsWritableSpanCompilesFor<int>");
+    // you should not be able to get writable elements from const bytes
+    static_assert(!AsWritableSpanCompilesFor<int, span<const byte>>,
+                  "!AsWritableSpanCompilesFor<int, span<const byte>>");
+    static_assert(!AsWritableSpanCompilesFor<const int, span<byte>>,
+                  "!AsWritableSpanCompilesFor<const int, span<byte>>");
+
+    std::uint32_t a[] = {1, 2, 3, 4};
+
+    {
+        const auto bs = as_bytes(span<std::uint32_t, 4>{a});
+        const auto s = as_span<std::uint32_t>(bs);
+        static_assert(std::is_same<decltype(s), const span<const std::uint32_t, 4>>::value,
+                      "as_span must keep the static extent");
+        EXPECT_TRUE(s.data() == a && s.size() == 4);
+
+        const auto halves = as_span<std::uint16_t>(bs);
+        static_assert(std::is_same<decltype(halves), const span<const std::uint16_t, 8>>::value,
+                      "as_span must scale the static extent");
+        EXPECT_TRUE(halves.size() == 8);
+    }
+
+    {
+        const span<byte> bs = as_writable_bytes(span<std::uint32_t>{a});
+        const auto s = as_writable_span<std::uint32_t>(bs);
+        static_assert(std::is_same<decltype(s), const span<std::uint32_t>>::value,
+                      "as_writable_span must keep the dynamic extent");
+        s[2] = 30;
+        EXPECT_TRUE(a[2] == 30 && s.size() == 4);
+
+        const auto c = as_span<std::uint32_t>(bs.subspan(4));
+        EXPECT_TRUE(c.size() == 3 && c[1] == 30);
+    }
+
+    {
+        const auto s = as_span<std::uint64_t>(span<const byte>{});
+        EXPECT_TRUE(s.empty() && s.data() == nullptr);
+    }
+}
+
+TEST(span_test, as_span_is_checked)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. as_span_is_checked";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    std::uint32_t a[] = {1, 2, 3, 4};
+    const span<byte> bs = as_writable_bytes(span<std::uint32_t>{a});
+
+    // misaligned
+    EXPECT_DEATH(as_span<std::uint32_t>(bs.subspan(1, 4)), expected);
+    EXPECT_DEATH(as_writable_span<std::uint16_t>(bs.subspan(3, 4)), expected);
+
+    // not a whole number of elements
+    EXPECT_DEATH(as_span<std::uint32_t>(bs.first(6)), expected);
+    EXPECT_DEATH(as_writable_span<std::uint64_t>(bs.first(12)), expected);
+}
+
 TEST(span_test, fixed_size_conversions)
 {
     const auto terminateHandler = std::set_terminate([] {
@@ -1249,6 +1326,128 @@ TEST(span_test, front_back)
     EXPECT_DEATH(s2.back(), expected);
 }
 
+TEST(span_test, chunks)
+{
+    int arr[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    const span<int> s{arr};
+
+    const auto c = s.chunks<4>();
+    static_assert(std::is_same<decltype(c[0]), span<int, 4>>::value,
+                  "chunks<N>() must yield span<T, N>");
+    EXPECT_TRUE(c.size() == 2);
+    EXPECT_FALSE(c.empty());
+    EXPECT_TRUE(c[0].data() == arr && c[1].data() == arr + 4);
+    EXPECT_TRUE(c.tail().data() == arr + 8 && c.tail().size() == 2);
+
+    int blocks = 0;
+    for (const span<int, 4> b : c)
+    {
+        EXPECT_TRUE(b[0] == blocks * 4);
+        b[3] = -1;
+        ++blocks;
+    }
+    EXPECT_TRUE(blocks == 2);
+    EXPECT_TRUE(arr[3] == -1 && arr[7] == -1 && arr[9] == 9);
+
+    const auto exact = s.first(8).chunks<4>();
+    EXPECT_TRUE(exact.size() == 2 && exact.tail().empty());
+
+    const auto short_span = s.first(3).chunks<4>();
+    EXPECT_TRUE(short_span.empty() && short_span.size() == 0);
+    EXPECT_TRUE(short_span.begin() == short_span.end());
+    EXPECT_TRUE(short_span.tail().size() == 3);
+
+    const auto none = span<int>{}.chunks<4>();
+    EXPECT_TRUE(none.empty() && none.tail().empty());
+
+    const span<const int, 10> fixed{arr};
+    const auto fixed_chunks = fixed.chunks<5>();
+    static_assert(std::is_same<decltype(fixed_chunks[1]), span<const int, 5>>::value,
+                  "chunks<N>() must keep the constness of the span");
+    EXPECT_TRUE(fixed_chunks.size() == 2 && fixed_chunks[1].back() == 9);
+}
+
+TEST(span_test, windows)
+{
+    int arr[5] = {1, 2, 3, 4, 5};
+    const span<int> s{arr};
+
+    const auto w = s.windows<3>();
+    EXPECT_TRUE(w.size() == 3);
+    EXPECT_TRUE(w[2].data() == arr + 2);
+    EXPECT_TRUE(w.tail().empty());
+
+    std::vector<int> sums;
+    for (const auto win : w) sums.push_back(win[0] + win[1] + win[2]);
+    EXPECT_TRUE((sums == std::vector<int>{6, 9, 12}));
+
+    EXPECT_TRUE(s.windows<5>().size() == 1);
+    EXPECT_TRUE(s.windows<1>().size() == 5);
+
+    const auto too_short = s.first(2).windows<3>();
+    EXPECT_TRUE(too_short.empty() && too_short.begin() == too_short.end());
+    EXPECT_TRUE(too_short.tail().size() == 2);
+}
+
+TEST(span_test, blocks_bounds)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. blocks_bounds";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    int arr[6] = {1, 2, 3, 4, 5, 6};
+    const span<int> s{arr};
+
+    EXPECT_DEATH(s.chunks<4>()[1], expected);
+    EXPECT_DEATH(s.windows<4>()[3], expected);
+
+    const auto c = s.chunks<4>();
+    auto it = c.end();
+    EXPECT_DEATH(*it, expected);
+    EXPECT_DEATH(++it, expected);
+    EXPECT_DEATH(static_cast<void>(c.begin() == s.subspan(1).chunks<4>().begin()), expected);
+}
+
+namespace
+{
+struct extent_probe
+{
+    template <std::size_t Extent>
+    std::size_t operator()(span<int, Extent> s) const
+    {
+        return Extent == dynamic_extent ? 0 : s.size();
+    }
+};
+} // namespace
+
+TEST(span_test, visit_extent)
+{
+    int arr[32] = {};
+    const span<int> s{arr};
+
+    EXPECT_TRUE((visit_extent<4, 8, 16, 32>(s.first(4), extent_probe{}) == 4));
+    EXPECT_TRUE((visit_extent<4, 8, 16, 32>(s.first(16), extent_probe{}) == 16));
+    EXPECT_TRUE((visit_extent<4, 8, 16, 32>(s, extent_probe{}) == 32));
+    EXPECT_TRUE((visit_extent<4, 8, 16, 32>(s.first(5), extent_probe{}) == 0));
+    EXPECT_TRUE((visit_extent<4, 8, 16, 32>(span<int>{}, extent_probe{}) == 0));
+    EXPECT_TRUE((visit_extent<>(s, extent_probe{}) == 0));
+
+    // the visitor sees the same elements, and may return a reference
+    int& last =
+        visit_extent<8>(s.last(8), [](auto block) -> int& { return block[block.size() - 1]; });
+    EXPECT_TRUE(&last == &arr[31]);
+
+    std::size_t fixed_calls = 0;
+    visit_extent<2, 3>(s.first(3), [&](auto block) {
+        if (decltype(block)::extent != dynamic_extent) ++fixed_calls;
+        for (int& x : block) x = 7;
+    });
+    EXPECT_TRUE(fixed_calls == 1);
+    EXPECT_TRUE(arr[2] == 7 && arr[3] == 0);
+}
+
 #if defined(FORCE_STD_SPAN_TESTS) || defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
 TEST(span_test, std_span)
 {
@@ -1266,6 +1465,51 @@ TEST(span_test, std_span)
 }
 #endif // defined(FORCE_STD_SPAN_TESTS) || defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
 
+#if defined(__cpp_lib_concepts)
+static_assert(std::contiguous_iterator<span<int>::iterator>,
+              "span iterator must model std::contiguous_iterator");
+static_assert(std::contiguous_iterator<span<const int>::iterator>,
+              "span iterator must model std::contiguous_iterator");
+static_assert(std::is_same<std::iter_value_t<span<const int>::iterator>, int>::value,
+              "iter_value_t of a span iterator must be its value_type");
+#endif // defined(__cpp_lib_concepts)
+
+TEST(span_test, std_algorithms)
+{
+    std::array<int, 4> a{1, 2, 3, 4};
+    std::array<int, 4> b{};
+    const span<int> sa{a};
+    const span<int> sb{b};
+
+    std::copy(sa.begin(), sa.end(), sb.begin());
+    EXPECT_TRUE(b == a);
+    EXPECT_TRUE(std::equal(sa.begin(), sa.end(), sb.begin(), sb.end()));
+
+    std::fill(sb.begin() + 2, sb.end(), 0);
+    EXPECT_TRUE(b[1] == 2 && b[2] == 0 && b[3] == 0);
+    EXPECT_FALSE(std::equal(sa.begin(), sa.end(), sb.begin(), sb.end()));
+    EXPECT_TRUE(std::lexicographical_compare(sb.begin(), sb.end(), sa.begin(), sa.end()));
+    EXPECT_FALSE(std::lexicographical_compare(sa.begin(), sa.end(), sb.begin(), sb.end()));
+
+#if defined(__cpp_lib_concepts)
+    EXPECT_TRUE(std::to_address(sa.begin() + 1) == a.data() + 1);
+    EXPECT_TRUE(std::to_address(sa.end()) == a.data() + a.size());
+#endif // defined(__cpp_lib_concepts)
+}
+
+// the standard library can see a pointer through the iterators, which is what its fast paths need
+#if defined(__cpp_lib_concepts)
+static_assert(std::contiguous_iterator<span<int>::iterator>,
+              "span iterators are contiguous iterators");
+static_assert(std::is_same<decltype(std::to_address(std::declval<span<const int>::iterator>())),
+                           const int*>::value,
+              "span iterators convert to pointers with to_address");
+#endif // defined(__cpp_lib_concepts)
+#if defined(_MSVC_STL_VERSION)
+static_assert(std::is_same<std::_Unwrapped_t<span<int>::iterator>, int*>::value,
+              "the MSVC STL unwraps span iterators to pointers");
+#endif // defined(_MSVC_STL_VERSION)
+
 #if defined(__cpp_lib_span) && defined(__cpp_lib_ranges)
 // This test covers the changes in PR #1100
 TEST(span_test, msvc_compile_error_PR1100)
@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// The single pointer span iterator changes span::iterator, so these tests are a program of their
+// own: every translation unit of a program must agree on GSL_UNCHECKED_SPAN_ITERATOR.
+#define GSL_UNCHECKED_SPAN_ITERATOR 1
+
+#include <gtest/gtest.h>
+
+#include <gsl/span> // for span, unchecked_span_iterator
+
+#include <algorithm>   // for copy, find
+#include <array>       // for array
+#include <iterator>    // for reverse_iterator
+#include <type_traits> // for is_same
+#include <vector>      // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+static_assert(std::is_same<span<int>::iterator, details::unchecked_span_iterator<int>>::value,
+              "span<int>::iterator must be the unchecked iterator in this translation unit");
+static_assert(sizeof(span<int>::iterator) == sizeof(int*),
+              "the unchecked span iterator must be a single pointer");
+
+#if defined(__cpp_lib_concepts)
+static_assert(std::contiguous_iterator<span<int>::iterator>,
+              "the unchecked span iterator must model std::contiguous_iterator");
+#endif // defined(__cpp_lib_concepts)
+
+TEST(span_unchecked_iterator_tests, range_for)
+{
+    int a[] = {1, 2, 3, 4};
+    const span<int> s = a;
+
+    int sum = 0;
+    for (int& x : s)
+    {
+        x *= 2;
+        sum += x;
+    }
+    EXPECT_TRUE(sum == 20);
+    EXPECT_TRUE(a[3] == 8);
+}
+
+TEST(span_unchecked_iterator_tests, arithmetic_and_comparisons)
+{
+    int a[] = {1, 2, 3, 4};
+    const span<int> s = a;
+
+    auto it = s.begin();
+    const auto first = it;
+    const auto beyond = s.end();
+
+    EXPECT_TRUE(beyond - first == 4);
+    EXPECT_TRUE(*it == 1);
+    EXPECT_TRUE(it[2] == 3);
+
+    ++it;
+    EXPECT_TRUE(*it == 2);
+    it += 2;
+    EXPECT_TRUE(*it == 4);
+    it -= 3;
+    EXPECT_TRUE(it == first);
+    EXPECT_TRUE(it < beyond);
+    EXPECT_TRUE(beyond > it);
+    EXPECT_TRUE(it <= first && it >= first);
+    EXPECT_TRUE(2 + it == beyond - 2);
+
+    span<int>::iterator it_default;
+    EXPECT_TRUE(it_default == span<int>::iterator{});
+
+    const span<const int> cs = s;
+    EXPECT_TRUE(cs.begin() == s.begin());
+    EXPECT_TRUE(cs.end() - s.begin() == 4);
+}
+
+TEST(span_unchecked_iterator_tests, reverse_and_algorithms)
+{
+    std::vector<int> v{1, 2, 3, 4};
+    const span<int> s = v;
+
+    std::array<int, 4> reversed{};
+    std::copy(s.rbegin(), s.rend(), reversed.begin());
+    EXPECT_TRUE(reversed[0] == 4 && reversed[3] == 1);
+
+    EXPECT_TRUE(std::find(s.begin(), s.end(), 3) - s.begin() == 2);
+    EXPECT_TRUE(std::find(s.begin(), s.end(), 5) == s.end());
+}
+
+TEST(span_unchecked_iterator_tests, range_checked_once)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. range_checked_once";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    int a[] = {1, 2, 3, 4, 5};
+    int* const first = a;
+    int* const last = a + 4;
+
+    EXPECT_DEATH(span<int>::iterator(first, last, last + 1), expected);
+    EXPECT_DEATH(span<int>::iterator(first + 1, last, first), expected);
+}
@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/span>         // for span
+#include <gsl/strided_span> // for strided_span, make_strided_span
+
+#include <algorithm>   // for max_element, sort, copy
+#include <array>       // for array
+#include <cstdint>     // for int32_t, int64_t, uint16_t
+#include <iterator>    // for iterator_traits
+#include <type_traits> // for is_same
+#include <vector>      // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+struct event
+{
+    std::int64_t timestamp;
+    std::uint16_t kind;
+    std::int32_t value;
+};
+
+std::vector<event> make_events()
+{
+    return {{30, 1, 5}, {10, 2, 15}, {20, 3, 25}, {40, 4, 35}};
+}
+} // namespace
+
+static_assert(std::is_same<std::iterator_traits<strided_span<int>::iterator>::iterator_category,
+                           std::random_access_iterator_tag>::value,
+              "strided_span iterators are random access");
+
+TEST(strided_span_tests, member_projection)
+{
+    auto events = make_events();
+    const auto timestamps = make_strided_span(span<event>(events), &event::timestamp);
+
+    static_assert(std::is_same<decltype(timestamps), const strided_span<std::int64_t>>::value,
+                  "make_strided_span keeps the member type");
+    EXPECT_TRUE(timestamps.size() == 4);
+    EXPECT_TRUE(timestamps.stride() == sizeof(event));
+    EXPECT_TRUE(timestamps.data() == &events[0].timestamp);
+    EXPECT_TRUE(timestamps[1] == 10);
+    EXPECT_TRUE(timestamps.front() == 30 && timestamps.back() == 40);
+
+    // writes go to the structs, there is no copy
+    timestamps[2] = 25;
+    EXPECT_TRUE(events[2].timestamp == 25);
+
+    const strided_span<const std::uint16_t> kinds(span<const event>(events), &event::kind);
+    EXPECT_TRUE(kinds[3] == 4);
+}
+
+TEST(strided_span_tests, from_span)
+{
+    std::array<int, 4> a{{1, 2, 3, 4}};
+    const strided_span<int> s = span<int>(a);
+    EXPECT_TRUE(s.stride() == sizeof(int));
+    EXPECT_TRUE(s[3] == 4);
+
+    // every other element
+    const strided_span<int> odd(a.data(), 2, 2 * sizeof(int));
+    EXPECT_TRUE(odd[0] == 1 && odd[1] == 3);
+
+    const strided_span<const int> c = odd;
+    EXPECT_TRUE(c[1] == 3);
+}
+
+TEST(strided_span_tests, iterators_and_algorithms)
+{
+    auto events = make_events();
+    const auto timestamps = make_strided_span(span<event>(events), &event::timestamp);
+
+    EXPECT_TRUE(timestamps.end() - timestamps.begin() == 4);
+    EXPECT_TRUE(*std::max_element(timestamps.begin(), timestamps.end()) == 40);
+
+    std::sort(timestamps.begin(), timestamps.end());
+    EXPECT_TRUE(events[0].timestamp == 10 && events[3].timestamp == 40);
+    // only the projected member moved
+    EXPECT_TRUE(events[0].kind == 1 && events[1].kind == 2);
+
+    std::vector<std::int64_t> reversed(4);
+    std::copy(timestamps.rbegin(), timestamps.rend(), reversed.begin());
+    EXPECT_TRUE(reversed[0] == 40 && reversed[3] == 10);
+
+    std::int64_t sum = 0;
+    for (const auto t : timestamps) sum += t;
+    EXPECT_TRUE(sum == 100);
+
+    auto it = timestamps.begin();
+    it += 3;
+    EXPECT_TRUE(*it == 40);
+    EXPECT_TRUE(it[-1] == 30);
+    EXPECT_TRUE(*it.operator->() == 40);
+    --it;
+    EXPECT_TRUE(it > timestamps.begin() && it < timestamps.end());
+
+    const strided_span<const std::int64_t>::iterator cit = it;
+    EXPECT_TRUE(*cit == 30);
+}
+
+TEST(strided_span_tests, subviews)
+{
+    auto events = make_events();
+    const auto values = make_strided_span(span<event>(events), &event::value);
+
+    EXPECT_TRUE(values.first(2).size() == 2);
+    EXPECT_TRUE(values.first(2)[1] == 15);
+    EXPECT_TRUE(values.last(1)[0] == 35);
+    EXPECT_TRUE(values.subspan(1, 2).back() == 25);
+    EXPECT_TRUE(values.subspan(4).empty());
+}
+
+TEST(strided_span_tests, empty)
+{
+    const strided_span<int> s;
+    EXPECT_TRUE(s.empty());
+    EXPECT_TRUE(s.begin() == s.end());
+
+    std::vector<event> none;
+    const auto timestamps = make_strided_span(span<event>(none), &event::timestamp);
+    EXPECT_TRUE(timestamps.empty());
+    EXPECT_TRUE(timestamps.data() == nullptr);
+}
+
+TEST(strided_span_tests, bounds_checks)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. bounds_checks";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    auto events = make_events();
+    const auto timestamps = make_strided_span(span<event>(events), &event::timestamp);
+
+    EXPECT_DEATH(timestamps[4], expected);
+    EXPECT_DEATH(timestamps.first(5), expected);
+    EXPECT_DEATH(timestamps.subspan(3, 2), expected);
+    EXPECT_DEATH(*timestamps.end(), expected);
+    EXPECT_DEATH(timestamps.begin() + 5, expected);
+    EXPECT_DEATH(timestamps.begin() - 1, expected);
+    EXPECT_DEATH(strided_span<int>().front(), expected);
+    EXPECT_DEATH((strided_span<int>(nullptr, 1, sizeof(int))), expected);
+
+    int a[4] = {};
+    // the stride would misalign the elements
+    EXPECT_DEATH((strided_span<int>(a, 2, 3)), expected);
+
+    auto other = make_events();
+    const auto other_timestamps = make_strided_span(span<event>(other), &event::timestamp);
+    EXPECT_DEATH(static_cast<void>(timestamps.begin() == other_timestamps.begin()), expected);
+}
+
+#if (defined(__cpp_deduction_guides) && (__cpp_deduction_guides >= 201611L))
+TEST(strided_span_tests, deduction_guides)
+{
+    auto events = make_events();
+    const strided_span kinds(span<const event>(events), &event::kind);
+    static_assert(std::is_same<decltype(kinds), const strided_span<const std::uint16_t>>::value,
+                  "deduced from a span and a member");
+    EXPECT_TRUE(kinds[1] == 2);
+}
+#endif // (defined(__cpp_deduction_guides) && (__cpp_deduction_guides >= 201611L))
@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/vectored_io> // for gather, scatter, write_all, read_all, pwrite_all, pread_all
+
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+
+#include <gsl/span> // for span, as_bytes, as_writable_bytes
+
+#include <algorithm>    // for equal, min
+#include <cstddef>      // for size_t, ptrdiff_t
+#include <cstdint>      // for uint32_t, uint64_t
+#include <cstdlib>      // for mkstemp
+#include <limits>       // for numeric_limits
+#include <string>       // for string
+#include <system_error> // for error_code, system_error, errc
+#include <thread>       // for thread
+#include <vector>       // for vector
+
+#include <unistd.h> // for pipe, read, write, close, unlink
+
+using namespace gsl;
+
+namespace
+{
+// the ends of a pipe, closed again by the destructor
+struct pipe_ends
+{
+    pipe_ends() { EXPECT_TRUE(::pipe(fds) == 0); }
+
+    pipe_ends(const pipe_ends&) = delete;
+    pipe_ends& operator=(const pipe_ends&) = delete;
+
+    ~pipe_ends()
+    {
+        close_read();
+        close_write();
+    }
+
+    int read_end() const { return fds[0]; }
+    int write_end() const { return fds[1]; }
+
+    void close_read() { close(0); }
+    void close_write() { close(1); }
+
+private:
+    void close(int i)
+    {
+        if (fds[i] != -1) ::close(fds[i]);
+        fds[i] = -1;
+    }
+
+    int fds[2] = {-1, -1};
+};
+
+std::vector<unsigned char> pattern(std::size_t size, unsigned seed)
+{
+    std::vector<unsigned char> v(size);
+    for (std::size_t i = 0; i < size; ++i) v[i] = static_cast<unsigned char>(i * seed + 1);
+    return v;
+}
+} // namespace
+
+TEST(vectored_io_tests, gather_and_scatter)
+{
+    const std::uint32_t header[2] = {1, 2};
+    const std::string body = "body";
+    const unsigned char trailer[1] = {3};
+
+    const auto parts = gather(span<const std::uint32_t>{header},
+                              span<const char>{body.data(), body.size()},
+                              span<const unsigned char>{trailer});
+    EXPECT_TRUE(parts.size() == 3);
+    EXPECT_TRUE(parts[0].size() == 8 && parts[1].size() == 4 && parts[2].size() == 1);
+    EXPECT_TRUE(static_cast<const void*>(parts[1].data()) == body.data());
+
+    std::uint32_t words[2] = {};
+    char text[4] = {};
+    const auto targets = scatter(span<std::uint32_t>{words}, span<char>{text});
+    EXPECT_TRUE(targets.size() == 2 && targets[0].size() == 8 && targets[1].size() == 4);
+    EXPECT_TRUE(static_cast<void*>(targets[1].data()) == text);
+}
+
+TEST(vectored_io_tests, write_and_read_a_pipe)
+{
+    pipe_ends p;
+    const auto a = pattern(10, 3);
+    const auto b = pattern(20, 5);
+    const std::vector<unsigned char> empty;
+
+    EXPECT_TRUE(write_all(p.write_end(), gather(make_span(a), make_span(empty), make_span(b))) ==
+                30);
+    p.close_write();
+
+    // the buffers split the bytes differently, and there are more buffers than bytes
+    std::vector<unsigned char> x(7);
+    std::vector<unsigned char> y(30);
+    std::error_code ec;
+    EXPECT_TRUE(read_all(p.read_end(), scatter(make_span(x), make_span(y)), ec) == 30);
+    EXPECT_FALSE(ec);
+
+    std::vector<unsigned char> all(a);
+    all.insert(all.end(), b.begin(), b.end());
+    EXPECT_TRUE(std::equal(x.begin(), x.end(), all.begin()));
+    EXPECT_TRUE(std::equal(y.begin(), y.begin() + 23, all.begin() + 7));
+
+    // at the end of the file
+    EXPECT_TRUE(read_all(p.read_end(), scatter(make_span(x)), ec) == 0);
+    EXPECT_FALSE(ec);
+}
+
+TEST(vectored_io_tests, partial_transfers)
+{
+    // many more buffers than fit into one call, and more bytes than fit into the pipe, so the
+    // transfers take several calls, and the reads come back partial and pick up in the middle
+    // of a buffer
+    std::vector<std::vector<unsigned char>> chunks;
+    std::size_t total = 0;
+    for (unsigned i = 0; i < 300; ++i)
+    {
+        chunks.push_back(pattern(i % 7 == 0 ? 0 : 1 + i * 37 % 5000, i));
+        total += chunks.back().size();
+    }
+    std::vector<span<const gsl::impl::byte>> out;
+    for (const auto& c : chunks) out.push_back(as_bytes(make_span(c)));
+
+    std::vector<unsigned char> received(total);
+    std::vector<span<gsl::impl::byte>> in;
+    const auto received_bytes = as_writable_bytes(make_span(received));
+    for (std::size_t i = 0; i < total; i += 999)
+        in.push_back(received_bytes.subspan(i, std::min<std::size_t>(999, total - i)));
+
+    pipe_ends p;
+    std::size_t read = 0;
+    std::error_code read_error;
+    std::thread reader{[&] { read = read_all(p.read_end(), in, read_error); }};
+    std::error_code write_error;
+    const std::size_t written = write_all(p.write_end(), out, write_error);
+    p.close_write();
+    reader.join();
+
+    EXPECT_TRUE(written == total && read == total);
+    EXPECT_FALSE(write_error);
+    EXPECT_FALSE(read_error);
+
+    std::size_t at = 0;
+    bool same = true;
+    for (const auto& c : chunks)
+    {
+        const auto start = received.begin() + static_cast<std::ptrdiff_t>(at);
+        same = same && std::equal(c.begin(), c.end(), start);
+        at += c.size();
+    }
+    EXPECT_TRUE(same);
+}
+
+TEST(vectored_io_tests, positioned)
+{
+    std::string path = ::testing::TempDir() + "gsl_vectored_io_XXXXXX";
+    const int fd = ::mkstemp(&path[0]);
+    ASSERT_TRUE(fd != -1);
+
+    const auto a = pattern(100, 3);
+    const auto b = pattern(50, 7);
+    EXPECT_TRUE(pwrite_all(fd, 1000, gather(make_span(a), make_span(b))) == 150);
+    EXPECT_TRUE(pwrite_all(fd, 0, gather(make_span(b))) == 50);
+
+    // the file offset is left alone
+    unsigned char first = 0;
+    EXPECT_TRUE(::read(fd, &first, 1) == 1 && first == b[0]);
+
+    std::vector<unsigned char> x(60);
+    std::vector<unsigned char> y(200);
+    std::error_code ec;
+    EXPECT_TRUE(pread_all(fd, 1040, scatter(make_span(x), make_span(y)), ec) == 110);
+    EXPECT_FALSE(ec);
+    EXPECT_TRUE(std::equal(x.begin(), x.end(), a.begin() + 40));
+    EXPECT_TRUE(std::equal(b.begin(), b.end(), y.begin()));
+
+    ::close(fd);
+    ::unlink(path.c_str());
+}
+
+TEST(vectored_io_tests, errors)
+{
+    pipe_ends p;
+    const auto a = pattern(10, 3);
+
+    std::error_code ec;
+    EXPECT_TRUE(write_all(-1, gather(make_span(a)), ec) == 0);
+    EXPECT_TRUE(ec == std::errc::bad_file_descriptor);
+
+    std::vector<unsigned char> x(10);
+    EXPECT_TRUE(read_all(p.write_end(), scatter(make_span(x)), ec) == 0);
+    EXPECT_TRUE(ec == std::errc::bad_file_descriptor);
+
+    // a pipe cannot be read or written at an offset
+    EXPECT_TRUE(pwrite_all(p.write_end(), 0, gather(make_span(a)), ec) == 0);
+    EXPECT_TRUE(ec == std::errc::invalid_seek);
+
+    // offsets past the largest off_t are not cut off
+    const auto past_end = static_cast<std::uint64_t>(std::numeric_limits<off_t>::max()) + 1;
+    EXPECT_TRUE(pwrite_all(p.write_end(), past_end, gather(make_span(a)), ec) == 0);
+    EXPECT_TRUE(ec == std::errc::value_too_large);
+    EXPECT_TRUE(pread_all(p.read_end(), std::numeric_limits<std::uint64_t>::max(),
+                          scatter(make_span(x)), ec) == 0);
+    EXPECT_TRUE(ec == std::errc::value_too_large);
+
+    // nothing to transfer
+    EXPECT_TRUE(write_all(-1, gather(), ec) == 0);
+    EXPECT_FALSE(ec);
+
+    EXPECT_THROW(write_all(-1, gather(make_span(a))), std::system_error);
+    EXPECT_THROW(read_all(-1, scatter(make_span(x))), std::system_error);
+    EXPECT_THROW(pwrite_all(-1, 0, gather(make_span(a))), std::system_error);
+    EXPECT_THROW(pread_all(-1, 0, scatter(make_span(x))), std::system_error);
+}
+
+#endif // defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
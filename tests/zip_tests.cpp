@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/span> // for span
+#include <gsl/zip>  // for zip, zip_view
+
+#include <iostream>    // for cerr
+#include <tuple>       // for get, tuple
+#include <type_traits> // for is_same
+#include <vector>      // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+TEST(zip_tests, construction)
+{
+    int a[3] = {1, 2, 3};
+    const std::vector<double> b{0.5, 1.5, 2.5};
+
+    const auto z = zip(span<int, 3>{a}, span<const double>{b});
+    static_assert(std::is_same<decltype(z), const zip_view<int, const double>>::value,
+                  "zip must keep the element types of the spans");
+    EXPECT_TRUE(z.size() == 3);
+    EXPECT_FALSE(z.empty());
+    EXPECT_TRUE(z.get<0>().data() == a && z.get<1>().data() == b.data());
+    EXPECT_TRUE(z.get<1>().size() == 3);
+
+    const zip_view<int, const double> direct{span<int>{a}, span<const double>{b}};
+    EXPECT_TRUE(direct.size() == 3);
+
+    const auto single = zip(span<int>{a});
+    EXPECT_TRUE(single.size() == 3);
+
+    const auto empty = zip(span<int>{}, span<double>{});
+    EXPECT_TRUE(empty.empty());
+    EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(zip_tests, element_access)
+{
+    int out[4] = {};
+    const int a[4] = {1, 2, 3, 4};
+    const int b[4] = {10, 20, 30, 40};
+
+    for (auto&& e : zip(span<int>{out}, span<const int>{a}, span<const int>{b}))
+        std::get<0>(e) = std::get<1>(e) * std::get<2>(e);
+    EXPECT_TRUE(out[0] == 10 && out[1] == 40 && out[2] == 90 && out[3] == 160);
+
+    const auto z = zip(span<int>{out}, span<const int>{a});
+    std::get<0>(z[1]) = 7;
+    EXPECT_TRUE(out[1] == 7 && std::get<1>(z[3]) == 4);
+    EXPECT_TRUE(&std::get<1>(z[2]) == &a[2]);
+
+    auto it = z.begin();
+    EXPECT_TRUE(&std::get<0>(*it++) == &out[0]);
+    EXPECT_TRUE(&std::get<0>(*it) == &out[1]);
+    ++it;
+    ++it;
+    ++it;
+    EXPECT_TRUE(it == z.end());
+
+#if defined(__cpp_structured_bindings) && __cpp_structured_bindings >= 201606L
+    for (auto [o, x] : zip(span<int>{out}, span<const int>{a})) o = x + 1;
+    EXPECT_TRUE(out[0] == 2 && out[3] == 5);
+#endif
+
+#if (defined(__cpp_deduction_guides) && (__cpp_deduction_guides >= 201611L))
+    const zip_view deduced{span<int, 4>{out}, span<const int>{a}};
+    static_assert(std::is_same<decltype(deduced), const zip_view<int, const int>>::value,
+                  "the deduction guide must drop the extents");
+    EXPECT_TRUE(deduced.size() == 4);
+#endif
+}
+
+TEST(zip_tests, sizes_are_checked)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. sizes_are_checked";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    int a[4] = {1, 2, 3, 4};
+    double b[3] = {1.0, 2.0, 3.0};
+
+    EXPECT_DEATH(zip(span<int>{a}, span<double>{b}), expected);
+    EXPECT_DEATH(zip(span<int, 4>{a}, span<double>{b}), expected);
+    EXPECT_DEATH((zip_view<int, double>{span<int>{a}, span<double>{b}}), expected);
+
+    const auto z = zip(span<int>{a}.first(3), span<double>{b});
+    EXPECT_DEATH(z[3], expected);
+    EXPECT_DEATH(*z.end(), expected);
+
+    auto it = z.end();
+    EXPECT_DEATH(++it, expected);
+}